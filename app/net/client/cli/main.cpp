@@ -43,6 +43,7 @@ int main(int argc, char** argv) {
         net::client::ClientConfig cfg;
         cfg.host = args.host;
         cfg.port = args.port;
+        cfg.encoding = args.encoding;
         cfg.mode = args.secure
             ? net::client::ClientMode::Secure
             : net::client::ClientMode::Plain;
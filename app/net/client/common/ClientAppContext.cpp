@@ -29,6 +29,9 @@ void ClientAppContext::disconnect() {
     }
 
     mUsers.clear();
+    mRosterVersion.reset();
+    mRefreshing = false;
+    mRefreshQueued = false;
     mMessages.clear();
     mMyUid = 0;
     mMyName.clear();
@@ -85,7 +88,12 @@ void ClientAppContext::wireClient() {
         mClient->requestAsync(
             "login",
             {{"name", mLoginName}},
-            [this](const json& res) { handleLoginResponse(res); }
+            [this](const json& res) { handleLoginResponse(res); },
+            [this](int code, const std::string& message) {
+                if (code == Client::kErrorClosed) return;  // already disconnecting
+                if (events.onError) events.onError("Login failed: " + message);
+                disconnect();
+            }
         );
     });
 
@@ -103,37 +111,82 @@ void ClientAppContext::wireClient() {
 }
 
 void ClientAppContext::handleLoginResponse(const json& response) {
-    if (response.contains("message")) {
-        if (events.onError)
-            events.onError("Login failed: " +
-                           response.value("message", "Unknown"));
-        disconnect();
-        return;
-    }
-
     mMyUid = response["uid"];
     mMyName = response["name"];
 
     mClient->requestAsync("client_list", {}, [this](const json& list) {
-        if (list.contains("clients")) {
-            for (const auto& c : list["clients"]) {
-                mUsers[c["uid"]] = {c["uid"], c["name"]};
-            }
-        }
+        applyRoster(list);
 
         if (events.onLoginSuccess) events.onLoginSuccess();
         if (events.onStateUpdated) events.onStateUpdated();
     });
 }
 
+void ClientAppContext::refreshUsers() {
+    if (!mClient) return;
+
+    // One delta request at a time; changes announced meanwhile are picked up by one more round
+    if (mRefreshing) {
+        mRefreshQueued = true;
+        return;
+    }
+    mRefreshing = true;
+
+    json params = json::object();
+    if (mRosterVersion) params["since"] = *mRosterVersion;
+
+    mClient->requestAsync("client_list", params,
+        [this](const json& list) {
+            mRefreshing = false;
+            applyRoster(list);
+            if (events.onStateUpdated) events.onStateUpdated();
+
+            if (mRefreshQueued) {
+                mRefreshQueued = false;
+                refreshUsers();
+            }
+        },
+        [this](int, const std::string&) {
+            // The next user_joined / user_left push tries again
+            mRefreshing = false;
+            mRefreshQueued = false;
+        });
+}
+
+void ClientAppContext::applyRoster(const json& list) {
+    // Full list replaces everything, a delta carries joined/renamed and left uids
+    // Unread counters survive for users that are still there
+    auto upsert = [this](const json& c) {
+        User& user = mUsers[c["uid"]];
+        user.uid = c["uid"];
+        user.name = c["name"];
+    };
+
+    if (list.contains("clients")) {
+        std::unordered_map<uint32_t, User> previous;
+        previous.swap(mUsers);
+        for (const auto& c : list["clients"]) {
+            auto it = previous.find(c["uid"]);
+            if (it != previous.end()) mUsers.insert(*it);
+            upsert(c);
+        }
+    } else {
+        for (const auto& c : list.value("joined", json::array())) upsert(c);
+        for (const auto& uid : list.value("left", json::array())) {
+            mUsers.erase(uid.get<uint32_t>());
+        }
+    }
+
+    if (list.contains("version")) mRosterVersion = list["version"].get<uint64_t>();
+}
+
 void ClientAppContext::handlePush(const json& p) {
     std::string evt = p.value("event", "");
 
-    if (evt == "user_joined") {
-        mUsers[p["uid"]] = {p["uid"], p["name"]};
-    }
-    else if (evt == "user_left") {
-        mUsers.erase(p["uid"]);
+    if (evt == "user_joined" || evt == "user_left") {
+        // The roster already has the change; fetch it as a delta since our version
+        refreshUsers();
+        return;
     }
     else if (evt == "public_message") {
         uint32_t fromUid = p.value("from_uid", 0);
@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <vector>
 #include <functional>
+#include <optional>
 
 #include <boost/asio.hpp>
 
@@ -39,6 +40,10 @@ public:
     void sendPublic(const std::string& text);
     void sendPrivate(uint32_t toUid, const std::string& text);
 
+    // Re-syncs the user list; only changes since the last known roster version travel.
+    // Called on user_joined / user_left pushes.
+    void refreshUsers();
+
     // ---- Read-only access for UI ----
     uint32_t myUid() const;
     const std::string& myName() const;
@@ -53,6 +58,7 @@ private:
     void wireClient();
     void handleLoginResponse(const json& response);
     void handlePush(const json& push);
+    void applyRoster(const json& list);
 
 private:
     boost::asio::io_context mIo;
@@ -64,5 +70,8 @@ private:
     std::string mLoginName;
 
     std::unordered_map<uint32_t, User> mUsers;
+    std::optional<uint64_t> mRosterVersion;
+    bool mRefreshing = false;
+    bool mRefreshQueued = false;
     std::vector<ChatMessage> mMessages;
 };
@@ -2,6 +2,7 @@
 
 #include <argparse/argparse.hpp>
 #include <iostream>
+#include <stdexcept>
 
 namespace app::client {
 
@@ -32,6 +33,12 @@ ClientArgs parseClientArgs(int argc, char** argv, const char* appName) {
         .default_value(args.name)
         .store_into(args.name);
 
+    std::string encoding = "json";
+    program.add_argument("--encoding")
+        .help("Message body encoding: json, msgpack or cbor")
+        .default_value(encoding)
+        .store_into(encoding);
+
     try {
         program.parse_args(argc, argv);
     } catch (const std::exception& e) {
@@ -40,6 +47,18 @@ ClientArgs parseClientArgs(int argc, char** argv, const char* appName) {
         throw;
     }
 
+    if (encoding == "json") {
+        args.encoding = net::protocol::BodyEncoding::Json;
+    } else if (encoding == "msgpack") {
+        args.encoding = net::protocol::BodyEncoding::MessagePack;
+    } else if (encoding == "cbor") {
+        args.encoding = net::protocol::BodyEncoding::Cbor;
+    } else {
+        std::cerr << "Unknown encoding: " << encoding << "\n\n";
+        std::cerr << program << "\n";
+        throw std::invalid_argument("Unknown encoding: " + encoding);
+    }
+
     return args;
 }
 
@@ -3,6 +3,8 @@
 #include <string>
 #include <cstdint>
 
+#include "net/protocol/BodyEncoding.h"
+
 namespace app::client {
 
     struct ClientArgs {
@@ -10,6 +12,7 @@ namespace app::client {
         uint16_t port    = 12345;
         bool secure      = false;
         std::string name = "guest";
+        net::protocol::BodyEncoding encoding = net::protocol::BodyEncoding::Json;
     };
 
     ClientArgs parseClientArgs(int argc, char** argv, const char* appName);
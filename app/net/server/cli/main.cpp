@@ -1,5 +1,6 @@
 #include <iostream>
 #include <string>
+#include <chrono>
 
 #include "app/net/server/common/ServerAppContext.h"
 #include "app/net/server/common/ServerArgs.h"
@@ -22,12 +23,29 @@ int main(int argc, char** argv) {
 
         std::cout << "Server running on port "
                   << args.config.port << "\n";
-        std::cout << "Type 'exit' to stop\n\n";
+        std::cout << "Type 'stats' for connection counters, 'exit' to stop\n\n";
 
         std::string line;
         while (std::getline(std::cin, line)) {
             if (line == "exit" || line == "quit" || line == "q")
                 break;
+
+            if (line == "stats") {
+                auto stats = ctx.stats(args.config.port);
+                auto us = [](std::chrono::nanoseconds ns) {
+                    return std::chrono::duration_cast<std::chrono::microseconds>(ns).count();
+                };
+
+                std::cout << "accepted:        " << stats.accept.accepted
+                          << " (" << stats.accept.acceptedPerSec << "/s, "
+                          << stats.accept.wakeups << " wakeups, "
+                          << stats.accept.acceptErrors << " errors)\n";
+                std::cout << "session start:   avg " << us(stats.sessionStart.average)
+                          << " us, max " << us(stats.sessionStart.max) << " us\n";
+                std::cout << "TLS handshake:   avg " << us(stats.tlsHandshake.average)
+                          << " us, max " << us(stats.tlsHandshake.max) << " us, "
+                          << stats.handshakeFailures << " failed\n";
+            }
         }
 
         ctx.stopAll();
@@ -1,6 +1,8 @@
 #include "app/net/server/common/ServerAppContext.h"
 #include "net/protocol/Message.h"
 
+#include <optional>
+
 using json = net::protocol::json;
 using Message = net::protocol::Message;
 
@@ -26,6 +28,10 @@ void ServerAppContext::stopAll() {
     mController->stopAll();
 }
 
+net::server::ServerStats ServerAppContext::stats(uint16_t port) const {
+    return mController->stats(port);
+}
+
 std::shared_ptr<net::server::SessionManager> ServerAppContext::sessions() const {
     return mSessions;
 }
@@ -42,10 +48,12 @@ void ServerAppContext::setupRoutes() {
         return {{"uid", uid}, {"name", name}, {"status", "success"}};
     });
     
-    mRouter->add("client_list", [this](const json&, uint32_t) -> json {
-        json arr = json::array();
-        for (auto id : mSessions->listIds()) arr.push_back({{"uid", id}, {"name", mSessions->getName(id)}});
-        return {{"clients", arr}};
+    // {"since": version} asks for joined/left since that roster version instead of the full list
+    // The full list is encoded once per roster version and spliced into every response
+    mRouter->addEncoded("client_list", [this](const json& p, uint32_t) {
+        std::optional<uint64_t> since;
+        if (p.is_object() && p.contains("since")) since = p["since"].get<uint64_t>();
+        return mSessions->roster().list(since);
     });
 
     mRouter->add("send_public", [this](const json& p, uint32_t uid) -> json {
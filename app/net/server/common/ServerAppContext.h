@@ -17,6 +17,8 @@ public:
     void stop(uint16_t port);
     void stopAll();
 
+    net::server::ServerStats stats(uint16_t port) const;
+
     std::shared_ptr<net::server::SessionManager> sessions() const;
     std::shared_ptr<net::server::Router> router() const;
 
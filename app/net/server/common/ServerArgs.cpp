@@ -2,6 +2,7 @@
 
 #include <argparse/argparse.hpp>
 #include <iostream>
+#include <stdexcept>
 
 namespace app::server {
 
@@ -33,6 +34,38 @@ ServerArgs parseServerArgs(int argc, char** argv, const char* appName) {
         .default_value(std::string("server.key"))
         .store_into(result.config.keyFile);
 
+    program.add_argument("--threads")
+        .help("Worker threads")
+        .scan<'u', unsigned int>()
+        .default_value(1u)
+        .store_into(result.config.workerThreads);
+
+    bool ioPerThread = false;
+    program.add_argument("--io-per-thread")
+        .help("Give every worker its own io_context instead of sharing one")
+        .default_value(false)
+        .implicit_value(true)
+        .store_into(ioPerThread);
+
+    bool reusePort = false;
+    program.add_argument("--reuseport")
+        .help("Open one SO_REUSEPORT acceptor per worker thread")
+        .default_value(false)
+        .implicit_value(true)
+        .store_into(reusePort);
+
+    std::string family = "v4";
+    program.add_argument("--bind")
+        .help("Address family: v4, v6 or dual")
+        .default_value(family)
+        .store_into(family);
+
+    program.add_argument("--backlog")
+        .help("Listen backlog (0 = system maximum)")
+        .scan<'i', int>()
+        .default_value(0)
+        .store_into(result.config.listenBacklog);
+
     try {
         program.parse_args(argc, argv);
     } catch (const std::exception& e) {
@@ -45,6 +78,24 @@ ServerArgs parseServerArgs(int argc, char** argv, const char* appName) {
         ? net::server::ServerMode::Secure
         : net::server::ServerMode::Plain;
 
+    result.config.threading = ioPerThread
+        ? net::server::ThreadingModel::ContextPerThread
+        : net::server::ThreadingModel::SharedContext;
+
+    result.config.reusePort = reusePort;
+
+    if (family == "v4") {
+        result.config.family = net::server::AddressFamily::V4;
+    } else if (family == "v6") {
+        result.config.family = net::server::AddressFamily::V6Only;
+    } else if (family == "dual") {
+        result.config.family = net::server::AddressFamily::DualStack;
+    } else {
+        std::cerr << "Unknown address family: " << family << "\n\n";
+        std::cerr << program << "\n";
+        throw std::invalid_argument("Unknown address family: " + family);
+    }
+
     return result;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <span>
 
 #include "crypto/core/types.h"
 
@@ -16,8 +17,14 @@ namespace crypto::core::symmetric {
         virtual size_t blockSize() const noexcept = 0;
         virtual size_t keySize() const noexcept = 0;
 
+        // Single block; out is resized to blockSize()
         virtual void encryptBlock(const Bytes& in, Bytes& out) const = 0;
         virtual void decryptBlock(const Bytes& in, Bytes& out) const = 0;
+
+        // ECB over nblocks consecutive blocks without allocating; in and out may alias exactly.
+        // Both spans must hold at least nblocks * blockSize() bytes.
+        virtual void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const = 0;
+        virtual void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const = 0;
     };
 
 }
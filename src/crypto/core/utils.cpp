@@ -66,4 +66,11 @@ namespace crypto::core::utils {
         data.resize(data.size() - paddingValue);
         return true;
     }
+
+    void secure_zeroize(void* buffer, size_t size) {
+        volatile uint8_t* p = static_cast<volatile uint8_t*>(buffer);
+        for (size_t i = 0; i < size; ++i) {
+            p[i] = 0;
+        }
+    }
 } // namespace crypto::core::utils
\ No newline at end of file
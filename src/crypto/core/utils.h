@@ -17,4 +17,7 @@ namespace crypto::core::utils {
     void pad(Bytes& data, size_t blockSize);
 
     bool unpad(Bytes& data);
+
+    // Clears key material through a volatile pointer so the stores are not optimized away
+    void secure_zeroize(void* buffer, size_t size);
 }
\ No newline at end of file
@@ -0,0 +1,329 @@
+#include "BigInt.h"
+#include "Montgomery.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include <openssl/rand.h>
+
+using crypto::core::Bytes;
+
+namespace crypto::modern::asymmetric {
+
+BigInt::BigInt(uint64_t value) {
+    while (value) {
+        m_limbs.push_back(static_cast<Limb>(value));
+        value >>= 32;
+    }
+}
+
+BigInt::BigInt(std::vector<Limb> limbs) : m_limbs(std::move(limbs)) {
+    trim();
+}
+
+void BigInt::trim() noexcept {
+    while (!m_limbs.empty() && m_limbs.back() == 0) m_limbs.pop_back();
+}
+
+BigInt BigInt::fromBytes(const Bytes& bytes) {
+    BigInt r;
+    r.m_limbs.assign((bytes.size() + 3) / 4, 0);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        size_t pos = bytes.size() - 1 - i;   // byte significance
+        r.m_limbs[pos / 4] |= static_cast<Limb>(bytes[i]) << (8 * (pos % 4));
+    }
+    r.trim();
+    return r;
+}
+
+Bytes BigInt::toBytes(size_t size) const {
+    size_t needed = (bitLength() + 7) / 8;
+    if (size == 0) size = needed;
+    if (needed > size) throw std::invalid_argument("BigInt does not fit in the requested size");
+
+    Bytes out(size, 0);
+    for (size_t pos = 0; pos < needed; ++pos) {
+        out[size - 1 - pos] = static_cast<uint8_t>(m_limbs[pos / 4] >> (8 * (pos % 4)));
+    }
+    return out;
+}
+
+BigInt BigInt::random(size_t bits) {
+    BigInt r;
+    r.m_limbs.resize((bits + 31) / 32);
+    // Primes and blinding factors come from here, so this must be a CSPRNG;
+    // std::random_device is not guaranteed to be one
+    if (!r.m_limbs.empty() &&
+        RAND_bytes(reinterpret_cast<unsigned char*>(r.m_limbs.data()),
+                   static_cast<int>(r.m_limbs.size() * sizeof(Limb))) != 1)
+        throw std::runtime_error("OpenSSL RAND_bytes failed");
+    if (bits % 32) r.m_limbs.back() &= (Limb{1} << (bits % 32)) - 1;
+    r.trim();
+    return r;
+}
+
+BigInt BigInt::randomRange(const BigInt& low, const BigInt& high) {
+    if (high <= low) throw std::invalid_argument("Empty random range");
+
+    // Rejection sampling keeps the distribution uniform
+    BigInt span = high - low;
+    size_t bits = span.bitLength();
+    BigInt r;
+    do {
+        r = random(bits);
+    } while (r >= span);
+    return low + r;
+}
+
+size_t BigInt::bitLength() const noexcept {
+    if (m_limbs.empty()) return 0;
+    return 32 * m_limbs.size() - std::countl_zero(m_limbs.back());
+}
+
+bool BigInt::testBit(size_t bit) const noexcept {
+    size_t limb = bit / 32;
+    return limb < m_limbs.size() && ((m_limbs[limb] >> (bit % 32)) & 1);
+}
+
+void BigInt::setBit(size_t bit) {
+    size_t limb = bit / 32;
+    if (limb >= m_limbs.size()) m_limbs.resize(limb + 1, 0);
+    m_limbs[limb] |= Limb{1} << (bit % 32);
+}
+
+BigInt::Limb BigInt::mod(Limb divisor) const {
+    if (divisor == 0) throw std::invalid_argument("Division by zero");
+    uint64_t r = 0;
+    for (size_t i = m_limbs.size(); i-- > 0;) r = ((r << 32) | m_limbs[i]) % divisor;
+    return static_cast<Limb>(r);
+}
+
+std::strong_ordering operator<=>(const BigInt& a, const BigInt& b) noexcept {
+    if (a.m_limbs.size() != b.m_limbs.size()) return a.m_limbs.size() <=> b.m_limbs.size();
+    for (size_t i = a.m_limbs.size(); i-- > 0;) {
+        if (a.m_limbs[i] != b.m_limbs[i]) return a.m_limbs[i] <=> b.m_limbs[i];
+    }
+    return std::strong_ordering::equal;
+}
+
+BigInt operator+(const BigInt& a, const BigInt& b) {
+    const BigInt& longer = a.m_limbs.size() >= b.m_limbs.size() ? a : b;
+    const BigInt& shorter = a.m_limbs.size() >= b.m_limbs.size() ? b : a;
+
+    BigInt r;
+    r.m_limbs.resize(longer.m_limbs.size() + 1);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < longer.m_limbs.size(); ++i) {
+        uint64_t sum = carry + longer.m_limbs[i] + (i < shorter.m_limbs.size() ? shorter.m_limbs[i] : 0);
+        r.m_limbs[i] = static_cast<BigInt::Limb>(sum);
+        carry = sum >> 32;
+    }
+    r.m_limbs.back() = static_cast<BigInt::Limb>(carry);
+    r.trim();
+    return r;
+}
+
+BigInt operator-(const BigInt& a, const BigInt& b) {
+    if (a < b) throw std::invalid_argument("BigInt subtraction would be negative");
+
+    BigInt r;
+    r.m_limbs.resize(a.m_limbs.size());
+    int64_t borrow = 0;
+    for (size_t i = 0; i < a.m_limbs.size(); ++i) {
+        int64_t diff = static_cast<int64_t>(a.m_limbs[i]) - borrow - (i < b.m_limbs.size() ? b.m_limbs[i] : 0);
+        borrow = diff < 0;
+        r.m_limbs[i] = static_cast<BigInt::Limb>(diff);
+    }
+    r.trim();
+    return r;
+}
+
+BigInt operator*(const BigInt& a, const BigInt& b) {
+    if (a.isZero() || b.isZero()) return BigInt{};
+
+    BigInt r;
+    r.m_limbs.assign(a.m_limbs.size() + b.m_limbs.size(), 0);
+    for (size_t i = 0; i < a.m_limbs.size(); ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < b.m_limbs.size(); ++j) {
+            uint64_t t = static_cast<uint64_t>(a.m_limbs[i]) * b.m_limbs[j] + r.m_limbs[i + j] + carry;
+            r.m_limbs[i + j] = static_cast<BigInt::Limb>(t);
+            carry = t >> 32;
+        }
+        r.m_limbs[i + b.m_limbs.size()] = static_cast<BigInt::Limb>(carry);
+    }
+    r.trim();
+    return r;
+}
+
+BigInt operator<<(const BigInt& a, size_t bits) {
+    if (a.isZero()) return a;
+
+    size_t limbs = bits / 32, shift = bits % 32;
+    BigInt r;
+    r.m_limbs.assign(a.m_limbs.size() + limbs + 1, 0);
+    for (size_t i = 0; i < a.m_limbs.size(); ++i) {
+        uint64_t v = static_cast<uint64_t>(a.m_limbs[i]) << shift;
+        r.m_limbs[i + limbs] |= static_cast<BigInt::Limb>(v);
+        r.m_limbs[i + limbs + 1] |= static_cast<BigInt::Limb>(v >> 32);
+    }
+    r.trim();
+    return r;
+}
+
+BigInt operator>>(const BigInt& a, size_t bits) {
+    size_t limbs = bits / 32, shift = bits % 32;
+    if (limbs >= a.m_limbs.size()) return BigInt{};
+
+    BigInt r;
+    r.m_limbs.resize(a.m_limbs.size() - limbs);
+    for (size_t i = 0; i < r.m_limbs.size(); ++i) {
+        uint64_t v = a.m_limbs[i + limbs];
+        if (i + limbs + 1 < a.m_limbs.size()) v |= static_cast<uint64_t>(a.m_limbs[i + limbs + 1]) << 32;
+        r.m_limbs[i] = static_cast<BigInt::Limb>(v >> shift);
+    }
+    r.trim();
+    return r;
+}
+
+void BigInt::divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder) {
+    if (b.isZero()) throw std::invalid_argument("Division by zero");
+    if (a < b) {
+        quotient = BigInt{};
+        remainder = a;
+        return;
+    }
+
+    const size_t n = b.m_limbs.size();
+    const size_t m = a.m_limbs.size();
+    BigInt q;
+    q.m_limbs.assign(m - n + 1, 0);
+
+    if (n == 1) {
+        uint64_t r = 0;
+        for (size_t i = m; i-- > 0;) {
+            uint64_t cur = (r << 32) | a.m_limbs[i];
+            q.m_limbs[i] = static_cast<Limb>(cur / b.m_limbs[0]);
+            r = cur % b.m_limbs[0];
+        }
+        q.trim();
+        quotient = std::move(q);
+        remainder = BigInt(r);
+        return;
+    }
+
+    // Normalize so the divisor's top limb has its high bit set; the quotient estimate is then off by at most 2
+    const int s = std::countl_zero(b.m_limbs.back());
+    std::vector<Limb> vn(n), un(m + 1);
+    for (size_t i = n - 1; i > 0; --i) {
+        vn[i] = (b.m_limbs[i] << s) | (s ? static_cast<Limb>(static_cast<uint64_t>(b.m_limbs[i - 1]) >> (32 - s)) : 0);
+    }
+    vn[0] = b.m_limbs[0] << s;
+    un[m] = s ? static_cast<Limb>(static_cast<uint64_t>(a.m_limbs[m - 1]) >> (32 - s)) : 0;
+    for (size_t i = m - 1; i > 0; --i) {
+        un[i] = (a.m_limbs[i] << s) | (s ? static_cast<Limb>(static_cast<uint64_t>(a.m_limbs[i - 1]) >> (32 - s)) : 0);
+    }
+    un[0] = a.m_limbs[0] << s;
+
+    constexpr uint64_t base = uint64_t{1} << 32;
+    for (size_t j = m - n + 1; j-- > 0;) {
+        uint64_t num = (static_cast<uint64_t>(un[j + n]) << 32) | un[j + n - 1];
+        uint64_t qhat = num / vn[n - 1];
+        uint64_t rhat = num % vn[n - 1];
+        while (qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= base) break;
+        }
+
+        // un[j .. j+n] -= qhat * vn
+        int64_t borrow = 0;
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t p = qhat * vn[i];
+            int64_t t = static_cast<int64_t>(un[i + j]) - borrow - static_cast<int64_t>(p & 0xFFFFFFFF);
+            un[i + j] = static_cast<Limb>(t);
+            borrow = static_cast<int64_t>(p >> 32) - (t >> 32);
+        }
+        int64_t t = static_cast<int64_t>(un[j + n]) - borrow;
+        un[j + n] = static_cast<Limb>(t);
+
+        // qhat was one too large: add the divisor back
+        if (t < 0) {
+            --qhat;
+            uint64_t carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t sum = static_cast<uint64_t>(un[i + j]) + vn[i] + carry;
+                un[i + j] = static_cast<Limb>(sum);
+                carry = sum >> 32;
+            }
+            un[j + n] += static_cast<Limb>(carry);
+        }
+        q.m_limbs[j] = static_cast<Limb>(qhat);
+    }
+
+    BigInt r;
+    r.m_limbs.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        r.m_limbs[i] = (un[i] >> s) | (s ? static_cast<Limb>(static_cast<uint64_t>(un[i + 1]) << (32 - s)) : 0);
+    }
+    r.trim();
+    q.trim();
+    quotient = std::move(q);
+    remainder = std::move(r);
+}
+
+BigInt operator/(const BigInt& a, const BigInt& b) {
+    BigInt q, r;
+    BigInt::divMod(a, b, q, r);
+    return q;
+}
+
+BigInt operator%(const BigInt& a, const BigInt& b) {
+    BigInt q, r;
+    BigInt::divMod(a, b, q, r);
+    return r;
+}
+
+BigInt BigInt::gcd(BigInt a, BigInt b) {
+    while (!b.isZero()) {
+        BigInt r = a % b;
+        a = std::move(b);
+        b = std::move(r);
+    }
+    return a;
+}
+
+BigInt BigInt::modInverse(const BigInt& a, const BigInt& m) {
+    // Extended Euclid with the Bezout coefficient kept reduced mod m, so it never goes negative
+    BigInt r0 = m, r1 = a % m;
+    BigInt t0, t1(1);
+    while (!r1.isZero()) {
+        BigInt q, r;
+        divMod(r0, r1, q, r);
+        r0 = std::move(r1);
+        r1 = std::move(r);
+
+        BigInt qt = (q * t1) % m;
+        BigInt t = t0 >= qt ? t0 - qt : t0 + m - qt;
+        t0 = std::move(t1);
+        t1 = std::move(t);
+    }
+    if (r0 != BigInt(1)) throw std::invalid_argument("No modular inverse");
+    return t0;
+}
+
+BigInt BigInt::modPow(const BigInt& base, const BigInt& exponent, const BigInt& modulus) {
+    if (modulus.isZero()) throw std::invalid_argument("Division by zero");
+    if (modulus.isOdd()) return Montgomery(modulus).pow(base, exponent);
+
+    // Even moduli never show up in RSA; plain square-and-multiply
+    BigInt result = BigInt(1) % modulus, b = base % modulus;
+    for (size_t i = exponent.bitLength(); i-- > 0;) {
+        result = (result * result) % modulus;
+        if (exponent.testBit(i)) result = (result * b) % modulus;
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "crypto/core/types.h"
+
+namespace crypto::modern::asymmetric {
+
+// Non-negative arbitrary-precision integer: little-endian 32-bit limbs, no leading zero limbs.
+// Not constant time; it backs the educational RSA.
+class BigInt {
+public:
+    using Limb = uint32_t;
+
+    BigInt() = default;
+    explicit BigInt(uint64_t value);
+    // Little-endian limbs; leading zeros are dropped
+    explicit BigInt(std::vector<Limb> limbs);
+
+    // Big-endian bytes, as stored in keys and ciphertexts
+    static BigInt fromBytes(const crypto::core::Bytes& bytes);
+    // Minimal big-endian encoding, or exactly `size` bytes (left-padded) if size != 0
+    crypto::core::Bytes toBytes(size_t size = 0) const;
+
+    // Uniform in [0, 2^bits) from OpenSSL's CSPRNG (RAND_bytes)
+    static BigInt random(size_t bits);
+    // Uniform in [low, high)
+    static BigInt randomRange(const BigInt& low, const BigInt& high);
+
+    bool isZero() const noexcept { return m_limbs.empty(); }
+    bool isOdd() const noexcept { return !m_limbs.empty() && (m_limbs[0] & 1); }
+    size_t bitLength() const noexcept;
+    bool testBit(size_t bit) const noexcept;
+    void setBit(size_t bit);
+
+    const std::vector<Limb>& limbs() const noexcept { return m_limbs; }
+
+    // Remainder modulo a small divisor, for sieving
+    Limb mod(Limb divisor) const;
+
+    friend BigInt operator+(const BigInt& a, const BigInt& b);
+    // Throws std::invalid_argument if b > a
+    friend BigInt operator-(const BigInt& a, const BigInt& b);
+    friend BigInt operator*(const BigInt& a, const BigInt& b);
+    friend BigInt operator/(const BigInt& a, const BigInt& b);
+    friend BigInt operator%(const BigInt& a, const BigInt& b);
+    friend BigInt operator<<(const BigInt& a, size_t bits);
+    friend BigInt operator>>(const BigInt& a, size_t bits);
+
+    friend std::strong_ordering operator<=>(const BigInt& a, const BigInt& b) noexcept;
+    friend bool operator==(const BigInt& a, const BigInt& b) noexcept = default;
+
+    // Knuth algorithm D; throws std::invalid_argument on division by zero
+    static void divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+
+    static BigInt gcd(BigInt a, BigInt b);
+    // a^-1 mod m; throws std::invalid_argument if gcd(a, m) != 1
+    static BigInt modInverse(const BigInt& a, const BigInt& m);
+    // Odd moduli go through Montgomery multiplication with a sliding window
+    static BigInt modPow(const BigInt& base, const BigInt& exponent, const BigInt& modulus);
+
+private:
+    std::vector<Limb> m_limbs;
+
+    void trim() noexcept;
+};
+
+}
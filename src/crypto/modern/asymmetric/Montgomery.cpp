@@ -0,0 +1,135 @@
+#include "Montgomery.h"
+
+#include <stdexcept>
+
+namespace crypto::modern::asymmetric {
+
+using Limb = BigInt::Limb;
+
+Montgomery::Montgomery(const BigInt& modulus) : m_modulus(modulus), m_n(modulus.limbs()) {
+    if (!modulus.isOdd()) throw std::invalid_argument("Montgomery modulus must be odd");
+
+    // Newton iteration for n^-1 mod 2^32: each step doubles the correct low bits (3 -> 48)
+    Limb inv = m_n[0];
+    for (int i = 0; i < 4; ++i) inv *= 2 - m_n[0] * inv;
+    m_n0inv = 0 - inv;
+
+    BigInt r2 = (BigInt(1) << (64 * m_n.size())) % modulus;
+    m_r2 = r2.limbs();
+    m_r2.resize(m_n.size(), 0);
+}
+
+void Montgomery::multiply(const Limbs& a, const Limbs& b, Limbs& out) const {
+    const size_t k = m_n.size();
+    // t holds k + 2 limbs; thread_local so the hot exponentiation loop does not allocate
+    thread_local std::vector<Limb> t;
+    t.assign(k + 2, 0);
+
+    for (size_t i = 0; i < k; ++i) {
+        uint64_t carry = 0;
+        const uint64_t bi = b[i];
+        for (size_t j = 0; j < k; ++j) {
+            uint64_t uv = t[j] + a[j] * bi + carry;
+            t[j] = static_cast<Limb>(uv);
+            carry = uv >> 32;
+        }
+        uint64_t uv = static_cast<uint64_t>(t[k]) + carry;
+        t[k] = static_cast<Limb>(uv);
+        t[k + 1] = static_cast<Limb>(uv >> 32);
+
+        // Add m * n so the low limb cancels, then shift down one limb
+        const uint64_t m = static_cast<Limb>(t[0] * m_n0inv);
+        carry = (t[0] + m * m_n[0]) >> 32;
+        for (size_t j = 1; j < k; ++j) {
+            uv = t[j] + m * m_n[j] + carry;
+            t[j - 1] = static_cast<Limb>(uv);
+            carry = uv >> 32;
+        }
+        uv = static_cast<uint64_t>(t[k]) + carry;
+        t[k - 1] = static_cast<Limb>(uv);
+        t[k] = t[k + 1] + static_cast<Limb>(uv >> 32);
+    }
+
+    // Result < 2n: one conditional subtraction
+    bool subtract = t[k] != 0;
+    if (!subtract) {
+        subtract = true;
+        for (size_t i = k; i-- > 0;) {
+            if (t[i] != m_n[i]) {
+                subtract = t[i] > m_n[i];
+                break;
+            }
+        }
+    }
+
+    out.resize(k);
+    if (subtract) {
+        int64_t borrow = 0;
+        for (size_t i = 0; i < k; ++i) {
+            int64_t diff = static_cast<int64_t>(t[i]) - borrow - m_n[i];
+            borrow = diff < 0;
+            out[i] = static_cast<Limb>(diff);
+        }
+    } else {
+        std::copy(t.begin(), t.begin() + k, out.begin());
+    }
+}
+
+Montgomery::Limbs Montgomery::toMontgomery(const BigInt& x) const {
+    Limbs limbs = (x < m_modulus ? x : x % m_modulus).limbs();
+    limbs.resize(m_n.size(), 0);
+    Limbs out;
+    multiply(limbs, m_r2, out);
+    return out;
+}
+
+BigInt Montgomery::fromMontgomery(const Limbs& x) const {
+    Limbs one(m_n.size(), 0), out;
+    one[0] = 1;
+    multiply(x, one, out);
+
+    return BigInt(std::move(out));
+}
+
+BigInt Montgomery::pow(const BigInt& base, const BigInt& exponent) const {
+    const size_t bits = exponent.bitLength();
+    if (bits == 0) return BigInt(1) % m_modulus;
+
+    // Window width by exponent size (HAC 14.85); table[i] = base^(2i + 1)
+    const size_t window = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 1;
+    std::vector<Limbs> table(size_t{1} << (window - 1));
+    table[0] = toMontgomery(base);
+    if (table.size() > 1) {
+        Limbs square;
+        multiply(table[0], table[0], square);
+        for (size_t i = 1; i < table.size(); ++i) multiply(table[i - 1], square, table[i]);
+    }
+
+    Limbs acc;
+    bool started = false;
+    for (size_t i = bits; i > 0;) {
+        if (!exponent.testBit(i - 1)) {
+            multiply(acc, acc, acc);
+            --i;
+            continue;
+        }
+
+        // Longest window ending in a set bit: bits [low, i)
+        size_t low = i > window ? i - window : 0;
+        while (!exponent.testBit(low)) ++low;
+        size_t value = 0;
+        for (size_t b = i; b > low; --b) value = (value << 1) | exponent.testBit(b - 1);
+
+        if (!started) {
+            acc = table[value >> 1];
+            started = true;
+        } else {
+            for (size_t b = low; b < i; ++b) multiply(acc, acc, acc);
+            multiply(acc, table[value >> 1], acc);
+        }
+        i = low;
+    }
+    return fromMontgomery(acc);
+}
+
+}
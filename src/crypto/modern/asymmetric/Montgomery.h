@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "BigInt.h"
+
+namespace crypto::modern::asymmetric {
+
+// Montgomery arithmetic modulo a fixed odd n with R = 2^(32k), k = limbs of n.
+// Values in Montgomery form are k-limb vectors holding x * R mod n.
+class Montgomery {
+public:
+    using Limbs = std::vector<BigInt::Limb>;
+
+    // Throws std::invalid_argument for an even or zero modulus
+    explicit Montgomery(const BigInt& modulus);
+
+    const BigInt& modulus() const noexcept { return m_modulus; }
+
+    Limbs toMontgomery(const BigInt& x) const;
+    BigInt fromMontgomery(const Limbs& x) const;
+
+    // a * b * R^-1 mod n (CIOS); out may alias a or b
+    void multiply(const Limbs& a, const Limbs& b, Limbs& out) const;
+
+    // base^exponent mod n, left-to-right sliding window over precomputed odd powers
+    BigInt pow(const BigInt& base, const BigInt& exponent) const;
+
+private:
+    BigInt m_modulus;
+    Limbs m_n;
+    Limbs m_r2;             // R^2 mod n, converts into Montgomery form
+    BigInt::Limb m_n0inv;   // -n^-1 mod 2^32
+};
+
+}
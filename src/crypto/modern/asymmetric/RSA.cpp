@@ -1,115 +1,279 @@
 #include "RSA.h"
-#include "crypto/core/utils.h"
+#include "Montgomery.h"
 
+#include <algorithm>
+#include <initializer_list>
 #include <stdexcept>
 
 using crypto::core::Bytes;
 using crypto::core::asymmetric::KeyPair;
-using crypto::core::utils::gcd;
-using crypto::core::utils::modInverse;
 
-namespace crypto::modern::asymmetric {
+namespace {
 
-bool RSA::isPrime(uint64_t n) const {
-    if (n < 2) return false;
-    for (uint64_t i = 2; i * i <= n; ++i)
-        if (n % i == 0) return false;
-    return true;
+using crypto::modern::asymmetric::BigInt;
+
+// Odd primes below 2^13, for trial division and the candidate sieve
+const std::vector<uint32_t>& smallPrimes() {
+    static const std::vector<uint32_t> primes = [] {
+        constexpr uint32_t limit = 1 << 13;
+        std::vector<bool> composite(limit, false);
+        std::vector<uint32_t> out;
+        for (uint32_t i = 3; i < limit; i += 2) {
+            if (composite[i]) continue;
+            out.push_back(i);
+            for (uint32_t j = i * i; j < limit; j += 2 * i) composite[j] = true;
+        }
+        return out;
+    }();
+    return primes;
 }
 
-uint64_t RSA::mulMod(uint64_t a, uint64_t b, uint64_t m) const {
-    uint64_t res = 0;
-    a %= m;
-    while (b > 0) {
-        if (b % 2 == 1) res = (res + a) % m;
-        a = (a * 2) % m;
-        b /= 2;
+// Rounds for a 2^-100 error bound on random candidates (FIPS 186-4, C.3)
+int millerRabinRounds(size_t bits) {
+    if (bits >= 1536) return 4;
+    if (bits >= 1024) return 5;
+    if (bits >= 512) return 7;
+    return 40;
+}
+
+bool millerRabin(const BigInt& n, int rounds) {
+    const BigInt one(1), two(2);
+    const BigInt nMinus1 = n - one;
+
+    size_t s = 0;
+    while (!nMinus1.testBit(s)) ++s;
+    const BigInt d = nMinus1 >> s;
+
+    crypto::modern::asymmetric::Montgomery mont(n);
+    for (int round = 0; round < rounds; ++round) {
+        BigInt x = mont.pow(BigInt::randomRange(two, nMinus1), d);
+        if (x == one || x == nMinus1) continue;
+
+        bool witness = true;
+        for (size_t i = 1; i < s && witness; ++i) {
+            x = (x * x) % n;
+            if (x == nMinus1) witness = false;
+        }
+        if (witness) return false;
     }
-    return res;
+    return true;
+}
+
 }
 
-uint64_t RSA::modPow(uint64_t base, uint64_t exp, uint64_t mod) const {
-    uint64_t result = 1;
-    base %= mod;
+namespace crypto::modern::asymmetric {
+
+bool RSA::isPrime(const BigInt& n, int rounds) {
+    if (n < BigInt(2)) return false;
+    if (!n.isOdd()) return n == BigInt(2);
 
-    while (exp > 0) {
-        if (exp & 1)
-            result = mulMod(result, base, mod); // Safe multiplication
-        base = mulMod(base, base, mod);         // Safe squaring
-        exp >>= 1;
+    for (uint32_t p : smallPrimes()) {
+        if (n == BigInt(p)) return true;
+        if (n.mod(p) == 0) return false;
     }
-    return result;
+    return millerRabin(n, rounds);
 }
 
+BigInt RSA::generatePrime(size_t bits) const {
+    // Even offsets scanned from each random start before drawing a new one
+    constexpr uint32_t SIEVE_SPAN = 1 << 16;
+
+    const auto& primes = smallPrimes();
+    const int rounds = millerRabinRounds(bits);
+    std::vector<uint32_t> residues(primes.size());
 
+    while (true) {
+        BigInt start = BigInt::random(bits);
+        start.setBit(bits - 1);
+        start.setBit(bits - 2);
+        start.setBit(0);
 
-Bytes RSA::encodeUint64(uint64_t v) const {
-    Bytes b(8);
-    for (int i = 0; i < 8; ++i)
-        b[7 - i] = static_cast<uint8_t>(v >> (i * 8));
-    return b;
+        // start + delta is divisible by p exactly when (residue + delta) % p == 0, so the
+        // sieve needs no bignum arithmetic per candidate
+        for (size_t i = 0; i < primes.size(); ++i) residues[i] = start.mod(primes[i]);
+        const uint32_t eResidue = start.mod(PUBLIC_EXPONENT);
+
+        for (uint32_t delta = 0; delta < SIEVE_SPAN; delta += 2) {
+            bool composite = false;
+            for (size_t i = 0; i < primes.size() && !composite; ++i) {
+                composite = (residues[i] + delta) % primes[i] == 0;
+            }
+            // p = 1 (mod e) would leave e without an inverse mod p - 1
+            if (composite || (eResidue + delta) % PUBLIC_EXPONENT == 1) continue;
+
+            BigInt candidate = start + BigInt(delta);
+            if (candidate.bitLength() != bits) break;
+            if (millerRabin(candidate, rounds)) return candidate;
+        }
+    }
 }
 
+void RSA::appendField(Bytes& out, const BigInt& value) {
+    Bytes bytes = value.toBytes();
+    uint32_t len = static_cast<uint32_t>(bytes.size());
+    for (int i = 3; i >= 0; --i) out.push_back(static_cast<uint8_t>(len >> (8 * i)));
+    out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+BigInt RSA::readField(const Bytes& in, size_t& offset) {
+    if (in.size() < offset + 4)
+        throw std::invalid_argument("Invalid key format");
 
-uint64_t RSA::decodeUint64(const Bytes& b, size_t offset) const {
-    if (b.size() < offset + 8)
+    size_t len = 0;
+    for (int i = 0; i < 4; ++i) len = (len << 8) | in[offset + i];
+    offset += 4;
+    if (in.size() - offset < len)
         throw std::invalid_argument("Invalid key format");
 
-    uint64_t v = 0;
-    for (int i = 0; i < 8; ++i)
-        v = (v << 8) | b[offset + i];
-    return v;
+    BigInt value = BigInt::fromBytes(Bytes(in.begin() + offset, in.begin() + offset + len));
+    offset += len;
+    return value;
 }
 
-KeyPair RSA::generateKeyPair(size_t /*bits*/) {
-    // fixed small primes (educational)
-    uint64_t p = 61;
-    uint64_t q = 53;
+KeyPair RSA::generateKeyPair(size_t bits) {
+    if (bits < MIN_BITS || bits % 2 != 0)
+        throw std::invalid_argument("RSA key size must be an even number of bits, at least 256");
 
-    uint64_t n   = p * q;
-    uint64_t phi = (p - 1) * (q - 1);
+    const BigInt one(1), e(PUBLIC_EXPONENT);
+    BigInt p = generatePrime(bits / 2), q;
+    do {
+        q = generatePrime(bits / 2);
+    } while (q == p);
 
-    uint64_t e = 17;
-    if (gcd(e, phi) != 1)
-        throw std::runtime_error("Invalid public exponent");
+    BigInt n = p * q;
+    BigInt phi = (p - one) * (q - one);
+    BigInt d = BigInt::modInverse(e, phi);
 
-    uint64_t d = modInverse(e, phi);
-    if (d == static_cast<uint64_t>(-1))
-        throw std::runtime_error("No modular inverse");
+    // CRT exponents and coefficient (PKCS #1 RSAPrivateKey order, with p > q not required)
+    BigInt dP = d % (p - one);
+    BigInt dQ = d % (q - one);
+    BigInt qInv = BigInt::modInverse(q, p);
 
     KeyPair kp;
-    kp.public_key.insert(kp.public_key.end(), encodeUint64(n).begin(), encodeUint64(n).end());
-    kp.public_key.insert(kp.public_key.end(), encodeUint64(e).begin(), encodeUint64(e).end());
+    appendField(kp.public_key, n);
+    appendField(kp.public_key, e);
 
-    kp.private_key.insert(kp.private_key.end(), encodeUint64(n).begin(), encodeUint64(n).end());
-    kp.private_key.insert(kp.private_key.end(), encodeUint64(d).begin(), encodeUint64(d).end());
+    for (const BigInt* field : std::initializer_list<const BigInt*>{ &n, &e, &d, &p, &q, &dP, &dQ, &qInv }) {
+        appendField(kp.private_key, *field);
+    }
 
     return kp;
 }
 
 Bytes RSA::encrypt(const Bytes& plaintext, const Bytes& public_key) {
-    if (plaintext.size() != 1)
-        throw std::invalid_argument("RSA demo supports 1-byte messages");
-
-    uint64_t n = decodeUint64(public_key, 0);
-    uint64_t e = decodeUint64(public_key, 8);
+    size_t offset = 0;
+    BigInt n = readField(public_key, offset);
+    BigInt e = readField(public_key, offset);
+    if (!n.isOdd())
+        throw std::invalid_argument("Invalid key format");
 
-    uint64_t m = plaintext[0];
-    if (m >= n)
+    const size_t k = (n.bitLength() + 7) / 8;
+    if (plaintext.size() + 2 > k)
         throw std::invalid_argument("Message too large");
 
-    uint64_t c = modPow(m, e, n);
-    return encodeUint64(c);
+    // 0x01 || plaintext is at most k - 1 bytes, so it stays below n
+    Bytes framed;
+    framed.reserve(plaintext.size() + 1);
+    framed.push_back(0x01);
+    framed.insert(framed.end(), plaintext.begin(), plaintext.end());
+
+    return BigInt::modPow(BigInt::fromBytes(framed), e, n).toBytes(k);
+}
+
+RSA::PrivateKey RSA::parsePrivateKey(const Bytes& key) {
+    PrivateKey k;
+    size_t offset = 0;
+    k.n = readField(key, offset);
+    BigInt second = readField(key, offset);
+
+    if (offset == key.size()) {
+        k.d = std::move(second);
+    } else {
+        k.e = std::move(second);
+        for (BigInt* field : { &k.d, &k.p, &k.q, &k.dP, &k.dQ, &k.qInv }) *field = readField(key, offset);
+        if (offset != key.size() || k.p * k.q != k.n)
+            throw std::invalid_argument("Invalid key format");
+        k.full = true;
+    }
+
+    if (!k.n.isOdd())
+        throw std::invalid_argument("Invalid key format");
+    return k;
+}
+
+std::pair<BigInt, BigInt> RSA::nextBlinding(const PrivateKey& key) {
+    {
+        std::lock_guard<std::mutex> lock(m_blindingMutex);
+        auto it = std::find_if(m_blinding.begin(), m_blinding.end(),
+                               [&](const Blinding& b) { return b.n == key.n; });
+        if (it != m_blinding.end() && it->uses < BLINDING_REFRESH) {
+            // (r^2)^e = (r^e)^2, so squaring both keeps the pair consistent
+            it->factor = (it->factor * it->factor) % key.n;
+            it->inverse = (it->inverse * it->inverse) % key.n;
+            ++it->uses;
+            std::rotate(m_blinding.begin(), it, it + 1);
+            return { m_blinding.front().factor, m_blinding.front().inverse };
+        }
+    }
+
+    BigInt r, rInv;
+    while (true) {
+        r = BigInt::randomRange(BigInt(2), key.n);
+        try {
+            rInv = BigInt::modInverse(r, key.n);
+            break;
+        } catch (const std::invalid_argument&) {
+            // r shares a factor with n; only possible with negligible probability
+        }
+    }
+    Blinding fresh{ key.n, BigInt::modPow(r, key.e, key.n), std::move(rInv), 1 };
+    std::pair<BigInt, BigInt> pair{ fresh.factor, fresh.inverse };
+
+    std::lock_guard<std::mutex> lock(m_blindingMutex);
+    std::erase_if(m_blinding, [&](const Blinding& b) { return b.n == key.n; });
+    m_blinding.insert(m_blinding.begin(), std::move(fresh));
+    if (m_blinding.size() > BLINDING_KEYS) m_blinding.pop_back();
+    return pair;
+}
+
+BigInt RSA::privateOp(const PrivateKey& key, const BigInt& c) {
+    if (!key.full) return BigInt::modPow(c, key.d, key.n);
+
+    // Blind with r: the exponentiations see c * r^e, and (c * r^e)^d = c^d * r
+    auto [factor, inverse] = nextBlinding(key);
+    BigInt blinded = (c * factor) % key.n;
+
+    BigInt m;
+    if (m_crt) {
+        // m1 = c^dP mod p, m2 = c^dQ mod q, m = m2 + q * (qInv * (m1 - m2) mod p)
+        BigInt m1 = BigInt::modPow(blinded, key.dP, key.p);
+        BigInt m2 = BigInt::modPow(blinded, key.dQ, key.q);
+        BigInt m2p = m2 % key.p;
+        BigInt diff = m1 >= m2p ? m1 - m2p : m1 + key.p - m2p;
+        m = m2 + key.q * ((key.qInv * diff) % key.p);
+    } else {
+        m = BigInt::modPow(blinded, key.d, key.n);
+    }
+
+    return (m * inverse) % key.n;
 }
 
 Bytes RSA::decrypt(const Bytes& ciphertext, const Bytes& private_key) {
-    uint64_t n = decodeUint64(private_key, 0);
-    uint64_t d = decodeUint64(private_key, 8);
+    PrivateKey key = parsePrivateKey(private_key);
+
+    const size_t k = (key.n.bitLength() + 7) / 8;
+    if (ciphertext.size() != k)
+        throw std::invalid_argument("Ciphertext size must match the modulus");
+
+    BigInt c = BigInt::fromBytes(ciphertext);
+    if (c >= key.n)
+        throw std::invalid_argument("Ciphertext out of range");
 
-    uint64_t c = decodeUint64(ciphertext, 0);
-    uint64_t m = modPow(c, d, n);
+    Bytes m = privateOp(key, c).toBytes();
+    if (m.empty() || m[0] != 0x01)
+        throw std::runtime_error("Decryption failed");
 
-    return Bytes{ static_cast<uint8_t>(m) };
+    return Bytes(m.begin() + 1, m.end());
 }
 
 }
@@ -1,15 +1,34 @@
 #pragma once
 #include <cstdint>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 #include "crypto/core/asymmetric/IAsymmetricCipher.h"
+#include "BigInt.h"
 
 namespace crypto::modern::asymmetric {
 
+// Textbook RSA on BigInt, for studying the arithmetic (no OAEP; use the OpenSSL wrapper for real data).
+// Keys are sequences of length-prefixed big-endian integers: public [n][e], private
+// [n][e][d][p][q][dP][dQ][qInv]. Private keys in the older [n][d] layout still decrypt,
+// through a plain modPow without blinding.
+// A plaintext is encrypted as the integer 0x01 || plaintext, so it may be empty or start with
+// zero bytes and must be at most modulus bytes - 2 long. Ciphertexts are modulus-sized.
+// decrypt() may be called on one instance from several threads (setCRT() may not).
 class RSA : public crypto::core::asymmetric::IAsymmetricCipher {
 public:
+    static constexpr uint32_t PUBLIC_EXPONENT = 65537;
+    static constexpr size_t MIN_BITS = 256;
+
     RSA() = default;
 
+    // CRT decryption (two half-size exponentiations, Garner recombination) is on by default;
+    // off runs a full-size modPow with d. Both blind the ciphertext when the key carries e.
+    void setCRT(bool enabled) noexcept { m_crt = enabled; }
+    bool crt() const noexcept { return m_crt; }
+
+    // bits >= MIN_BITS and even; n has exactly `bits` bits
     crypto::core::asymmetric::KeyPair generateKeyPair(size_t bits) override;
 
     crypto::core::Bytes encrypt(
@@ -22,13 +41,43 @@ public:
         const crypto::core::Bytes& private_key
     ) override;
 
+    // Trial division by the small primes, then Miller-Rabin with random bases
+    static bool isPrime(const BigInt& n, int rounds);
+
 private:
-    bool isPrime(uint64_t n) const;
-    uint64_t modPow(uint64_t base, uint64_t exp, uint64_t mod) const;
-    uint64_t mulMod(uint64_t a, uint64_t b, uint64_t m) const;
+    struct PrivateKey {
+        BigInt n, e, d, p, q, dP, dQ, qInv;
+        bool full = false;  // false for legacy [n][d] keys
+    };
+
+    // Blinding pair (r^e, r^-1) for one modulus. Squared after each use and redrawn every
+    // BLINDING_REFRESH uses, so the modular inverse is not paid per call.
+    struct Blinding {
+        BigInt n, factor, inverse;
+        unsigned uses = 0;
+    };
+    static constexpr unsigned BLINDING_REFRESH = 32;
+    // Moduli with a cached pair, so alternating between a few keys keeps each one's pair
+    static constexpr size_t BLINDING_KEYS = 8;
+
+    bool m_crt = true;
+    // Most recently used first; the mutex lets one instance decrypt on several threads
+    std::mutex m_blindingMutex;
+    std::vector<Blinding> m_blinding;
+
+    static PrivateKey parsePrivateKey(const crypto::core::Bytes& key);
+    // c^d mod n for c < n
+    BigInt privateOp(const PrivateKey& key, const BigInt& c);
+    // Next (factor, inverse) pair for key.n; only the cache lookup runs under the mutex
+    std::pair<BigInt, BigInt> nextBlinding(const PrivateKey& key);
+
+    // Random prime with the top two bits set (so p * q has exactly 2 * bits bits) and
+    // p - 1 coprime to PUBLIC_EXPONENT. Candidates are stepped through a small-prime sieve.
+    BigInt generatePrime(size_t bits) const;
+
     // helpers
-    crypto::core::Bytes encodeUint64(uint64_t v) const;
-    uint64_t decodeUint64(const crypto::core::Bytes& b, size_t offset) const;
+    static void appendField(crypto::core::Bytes& out, const BigInt& value);
+    static BigInt readField(const crypto::core::Bytes& in, size_t& offset);
 };
 
 }
@@ -8,7 +8,7 @@
 
 
 namespace {
-    const uint8_t S_BOX[256] = {
+    constexpr uint8_t S_BOX[256] = {
         //0     1    2      3     4    5     6     7      8    9     A      B    C     D     E     F
         0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
         0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
@@ -28,7 +28,7 @@ namespace {
         0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16 
     };
 
-    const uint8_t INV_S_BOX[256] = {
+    constexpr uint8_t INV_S_BOX[256] = {
         0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e, 0x81, 0xf3, 0xd7, 0xfb,
         0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87, 0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb,
         0x54, 0x7b, 0x94, 0x32, 0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
@@ -50,9 +50,9 @@ namespace {
     const uint8_t RCON[11] = { 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36  };
      
 
-    inline uint8_t xtime(uint8_t x) { return (x << 1) ^ (((x >> 7) & 1) * 0x1b); }
+    constexpr uint8_t xtime(uint8_t x) { return (x << 1) ^ (((x >> 7) & 1) * 0x1b); }
 
-    uint8_t multiply(uint8_t x, uint8_t y) {
+    constexpr uint8_t multiply(uint8_t x, uint8_t y) {
         uint8_t res = 0;
         for (int i = 0; i < 8; i++) {
             if ((y >> i) & 1) res ^= x;
@@ -61,13 +61,53 @@ namespace {
         return res;
     }
 
-    void secure_zeroize(void* buffer, size_t size) {
-        volatile uint8_t* p = static_cast<volatile uint8_t*>(buffer);
-        for (size_t i = 0; i < size; ++i) {
-            p[i] = 0;
+    // ---- T-tables: SubBytes + MixColumns (or their inverses) folded into one lookup per byte ----
+    using Table = std::array<uint32_t, 256>;
+
+    constexpr uint32_t pack(uint8_t b0, uint8_t b1, uint8_t b2, uint8_t b3) {
+        return (uint32_t(b0) << 24) | (uint32_t(b1) << 16) | (uint32_t(b2) << 8) | uint32_t(b3);
+    }
+
+    constexpr uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    constexpr Table makeTe(int rotation) {
+        Table t{};
+        for (int x = 0; x < 256; ++x) {
+            uint8_t s = S_BOX[x];
+            uint32_t w = pack(multiply(s, 2), s, s, multiply(s, 3));
+            t[x] = rotation ? rotr(w, rotation) : w;
+        }
+        return t;
+    }
+
+    constexpr Table makeTd(int rotation) {
+        Table t{};
+        for (int x = 0; x < 256; ++x) {
+            uint8_t s = INV_S_BOX[x];
+            uint32_t w = pack(multiply(s, 0x0e), multiply(s, 0x09), multiply(s, 0x0d), multiply(s, 0x0b));
+            t[x] = rotation ? rotr(w, rotation) : w;
         }
+        return t;
+    }
+
+    constexpr Table Te0 = makeTe(0), Te1 = makeTe(8), Te2 = makeTe(16), Te3 = makeTe(24);
+    constexpr Table Td0 = makeTd(0), Td1 = makeTd(8), Td2 = makeTd(16), Td3 = makeTd(24);
+
+    inline uint32_t load_be(const uint8_t* p) {
+        return pack(p[0], p[1], p[2], p[3]);
+    }
+
+    inline void store_be(uint8_t* p, uint32_t w) {
+        p[0] = uint8_t(w >> 24); p[1] = uint8_t(w >> 16); p[2] = uint8_t(w >> 8); p[3] = uint8_t(w);
+    }
+
+    // InvMixColumns of a key word: Td* already include InvSubBytes, so feed them S-boxed bytes
+    inline uint32_t inv_mix_column(uint32_t w) {
+        return Td0[S_BOX[w >> 24]] ^ Td1[S_BOX[(w >> 16) & 0xFF]] ^ Td2[S_BOX[(w >> 8) & 0xFF]] ^ Td3[S_BOX[w & 0xFF]];
     }
 
+    using crypto::core::utils::secure_zeroize;
+
     static uint32_t get_word(const std::array<uint8_t, crypto::modern::block::symmetric::MAX_AES_SCHEDULE_SIZE>& key_schedule, size_t index) {
         size_t start = index * 4;
         return (static_cast<uint32_t>(key_schedule[start]) << 24) |
@@ -97,7 +137,7 @@ namespace crypto::modern::block::symmetric {
 
     
 
-    AES::AES(size_t keySizeBytes): m_keySizeBytes(keySizeBytes){
+    AES::AES(size_t keySizeBytes, Engine engine): m_keySizeBytes(keySizeBytes), m_engine(engine){
         if (keySizeBytes != 16 && keySizeBytes != 24 && keySizeBytes != 32) {
             throw std::invalid_argument("Invalid AES key size");
         }
@@ -105,6 +145,8 @@ namespace crypto::modern::block::symmetric {
 
     AES::~AES() {
         secure_zeroize(m_roundKeys.data(), m_roundKeys.size());
+        secure_zeroize(m_encKeys.data(), m_encKeys.size() * sizeof(uint32_t));
+        secure_zeroize(m_decKeys.data(), m_decKeys.size() * sizeof(uint32_t));
     }
 
     void AES::setKey(const Bytes& key) {
@@ -112,19 +154,53 @@ namespace crypto::modern::block::symmetric {
             throw std::invalid_argument("Key size does not match the initialized size");
         }
         keyExpansion(key);
+        tableKeySchedule();
     }
 
     void AES::encryptBlock(const Bytes& plaintext, Bytes& output) const {
         if (plaintext.size() != 16) throw std::invalid_argument("Block size error");
         output.resize(16);
+        encryptBlocks(plaintext, output, 1);
+    }
+
+    void AES::decryptBlock(const Bytes& ciphertext, Bytes& output) const {
+        if (ciphertext.size() != 16) throw std::invalid_argument("Block size error");
+        output.resize(16);
+        decryptBlocks(ciphertext, output, 1);
+    }
 
+    void AES::encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+        const uint8_t* src = in.data();
+        uint8_t* dst = out.data();
+        if (m_engine == Engine::TTable) {
+            for (size_t i = 0; i < nblocks; ++i) encryptTTable(src + 16 * i, dst + 16 * i);
+        } else {
+            for (size_t i = 0; i < nblocks; ++i) encryptReference(src + 16 * i, dst + 16 * i);
+        }
+    }
+
+    void AES::decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+        const uint8_t* src = in.data();
+        uint8_t* dst = out.data();
+        if (m_engine == Engine::TTable) {
+            for (size_t i = 0; i < nblocks; ++i) decryptTTable(src + 16 * i, dst + 16 * i);
+        } else {
+            for (size_t i = 0; i < nblocks; ++i) decryptReference(src + 16 * i, dst + 16 * i);
+        }
+    }
+
+    void AES::encryptReference(const uint8_t* plaintext, uint8_t* output) const {
         State state;
         // 1. Copy plaintext into State (Column-major order)
         for (int i = 0; i < 4; i++)
             for (int j = 0; j < 4; j++)
                 state[j][i] = plaintext[i * 4 + j];
 
-        int Nr = (m_keySizeBytes / 4) + 6; 
+        int Nr = static_cast<int>(rounds());
 
         // Initial Round
         addRoundKey(state, 0);
@@ -149,16 +225,13 @@ namespace crypto::modern::block::symmetric {
     }
 
 
-    void AES::decryptBlock(const Bytes& ciphertext, Bytes& output) const {
-        if (ciphertext.size() != 16) throw std::invalid_argument("Block size error");
-        output.resize(16);
-
+    void AES::decryptReference(const uint8_t* ciphertext, uint8_t* output) const {
         State state;
         for (int i = 0; i < 4; i++)
             for (int j = 0; j < 4; j++)
                 state[j][i] = ciphertext[i * 4 + j];
 
-        int Nr = (m_keySizeBytes / 4) + 6;
+        int Nr = static_cast<int>(rounds());
 
         // Initial Round
         addRoundKey(state, Nr);
@@ -181,6 +254,59 @@ namespace crypto::modern::block::symmetric {
                 output[i * 4 + j] = state[j][i];
     }
 
+    void AES::encryptTTable(const uint8_t* in, uint8_t* out) const {
+        const uint32_t* rk = m_encKeys.data();
+        const size_t Nr = rounds();
+
+        uint32_t s0 = load_be(in)      ^ rk[0];
+        uint32_t s1 = load_be(in + 4)  ^ rk[1];
+        uint32_t s2 = load_be(in + 8)  ^ rk[2];
+        uint32_t s3 = load_be(in + 12) ^ rk[3];
+
+        // Each output column takes row r from column (c + r): ShiftRows is in the indexing
+        for (size_t round = 1; round < Nr; ++round) {
+            rk += 4;
+            uint32_t t0 = Te0[s0 >> 24] ^ Te1[(s1 >> 16) & 0xFF] ^ Te2[(s2 >> 8) & 0xFF] ^ Te3[s3 & 0xFF] ^ rk[0];
+            uint32_t t1 = Te0[s1 >> 24] ^ Te1[(s2 >> 16) & 0xFF] ^ Te2[(s3 >> 8) & 0xFF] ^ Te3[s0 & 0xFF] ^ rk[1];
+            uint32_t t2 = Te0[s2 >> 24] ^ Te1[(s3 >> 16) & 0xFF] ^ Te2[(s0 >> 8) & 0xFF] ^ Te3[s1 & 0xFF] ^ rk[2];
+            uint32_t t3 = Te0[s3 >> 24] ^ Te1[(s0 >> 16) & 0xFF] ^ Te2[(s1 >> 8) & 0xFF] ^ Te3[s2 & 0xFF] ^ rk[3];
+            s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+        }
+
+        // Final round: SubBytes + ShiftRows only
+        rk += 4;
+        store_be(out,      pack(S_BOX[s0 >> 24], S_BOX[(s1 >> 16) & 0xFF], S_BOX[(s2 >> 8) & 0xFF], S_BOX[s3 & 0xFF]) ^ rk[0]);
+        store_be(out + 4,  pack(S_BOX[s1 >> 24], S_BOX[(s2 >> 16) & 0xFF], S_BOX[(s3 >> 8) & 0xFF], S_BOX[s0 & 0xFF]) ^ rk[1]);
+        store_be(out + 8,  pack(S_BOX[s2 >> 24], S_BOX[(s3 >> 16) & 0xFF], S_BOX[(s0 >> 8) & 0xFF], S_BOX[s1 & 0xFF]) ^ rk[2]);
+        store_be(out + 12, pack(S_BOX[s3 >> 24], S_BOX[(s0 >> 16) & 0xFF], S_BOX[(s1 >> 8) & 0xFF], S_BOX[s2 & 0xFF]) ^ rk[3]);
+    }
+
+    void AES::decryptTTable(const uint8_t* in, uint8_t* out) const {
+        const uint32_t* rk = m_decKeys.data();
+        const size_t Nr = rounds();
+
+        uint32_t s0 = load_be(in)      ^ rk[0];
+        uint32_t s1 = load_be(in + 4)  ^ rk[1];
+        uint32_t s2 = load_be(in + 8)  ^ rk[2];
+        uint32_t s3 = load_be(in + 12) ^ rk[3];
+
+        // InvShiftRows: row r comes from column (c - r)
+        for (size_t round = 1; round < Nr; ++round) {
+            rk += 4;
+            uint32_t t0 = Td0[s0 >> 24] ^ Td1[(s3 >> 16) & 0xFF] ^ Td2[(s2 >> 8) & 0xFF] ^ Td3[s1 & 0xFF] ^ rk[0];
+            uint32_t t1 = Td0[s1 >> 24] ^ Td1[(s0 >> 16) & 0xFF] ^ Td2[(s3 >> 8) & 0xFF] ^ Td3[s2 & 0xFF] ^ rk[1];
+            uint32_t t2 = Td0[s2 >> 24] ^ Td1[(s1 >> 16) & 0xFF] ^ Td2[(s0 >> 8) & 0xFF] ^ Td3[s3 & 0xFF] ^ rk[2];
+            uint32_t t3 = Td0[s3 >> 24] ^ Td1[(s2 >> 16) & 0xFF] ^ Td2[(s1 >> 8) & 0xFF] ^ Td3[s0 & 0xFF] ^ rk[3];
+            s0 = t0; s1 = t1; s2 = t2; s3 = t3;
+        }
+
+        rk += 4;
+        store_be(out,      pack(INV_S_BOX[s0 >> 24], INV_S_BOX[(s3 >> 16) & 0xFF], INV_S_BOX[(s2 >> 8) & 0xFF], INV_S_BOX[s1 & 0xFF]) ^ rk[0]);
+        store_be(out + 4,  pack(INV_S_BOX[s1 >> 24], INV_S_BOX[(s0 >> 16) & 0xFF], INV_S_BOX[(s3 >> 8) & 0xFF], INV_S_BOX[s2 & 0xFF]) ^ rk[1]);
+        store_be(out + 8,  pack(INV_S_BOX[s2 >> 24], INV_S_BOX[(s1 >> 16) & 0xFF], INV_S_BOX[(s0 >> 8) & 0xFF], INV_S_BOX[s3 & 0xFF]) ^ rk[2]);
+        store_be(out + 12, pack(INV_S_BOX[s3 >> 24], INV_S_BOX[(s2 >> 16) & 0xFF], INV_S_BOX[(s1 >> 8) & 0xFF], INV_S_BOX[s0 & 0xFF]) ^ rk[3]);
+    }
+
     size_t AES::blockSize() const noexcept {
         return 16; // AES block size is always 16 bytes
     }
@@ -189,6 +315,33 @@ namespace crypto::modern::block::symmetric {
         return m_keySizeBytes;
     }
 
+    AES::Engine AES::engine() const noexcept {
+        return m_engine;
+    }
+
+    std::span<const uint8_t> AES::roundKeys() const noexcept {
+        return std::span<const uint8_t>(m_roundKeys.data(), 16 * (rounds() + 1));
+    }
+
+    size_t AES::rounds() const noexcept {
+        return (m_keySizeBytes / 4) + 6;
+    }
+
+    void AES::tableKeySchedule() {
+        const size_t Nr = rounds();
+        const size_t words = 4 * (Nr + 1);
+
+        for (size_t i = 0; i < words; ++i) m_encKeys[i] = get_word(m_roundKeys, i);
+
+        // Equivalent inverse cipher: round keys in reverse order, InvMixColumns on the inner ones
+        for (size_t round = 0; round <= Nr; ++round) {
+            for (size_t c = 0; c < 4; ++c) {
+                uint32_t w = m_encKeys[(Nr - round) * 4 + c];
+                m_decKeys[round * 4 + c] = (round == 0 || round == Nr) ? w : inv_mix_column(w);
+            }
+        }
+    }
+
     void AES::keyExpansion(const Bytes& key) {
         secure_zeroize(m_roundKeys.data(), m_roundKeys.size());
 
@@ -1,5 +1,7 @@
 #pragma once
 #include <array>
+#include <cstdint>
+#include <span>
 
 #include "crypto/core/symmetric/IBlockCipher.h"
 
@@ -10,7 +12,13 @@ namespace crypto::modern::block::symmetric{
 
     class AES final : public crypto::core::symmetric::IBlockCipher{
     public:
-        AES(size_t keySizeBytes);
+        // Reference: byte-wise FIPS-197 rounds; the default.
+        // TTable:    32-bit table lookups, equivalent inverse cipher for decryption. Faster, but its
+        //            4 KB of key-dependent table lookups leak key bits through cache timing, so it
+        //            is opt-in for callers that accept that. AESBitsliced is the constant-time option.
+        enum class Engine { Reference, TTable };
+
+        explicit AES(size_t keySizeBytes, Engine engine = Engine::Reference);
         ~AES() override;
 
         void setKey(const Bytes& bytes) override;
@@ -19,16 +27,37 @@ namespace crypto::modern::block::symmetric{
 
         void decryptBlock(const Bytes& ciphertext, Bytes& output) const override;
 
+        void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+        void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+
         size_t blockSize() const noexcept override;
 
         size_t keySize() const noexcept override;
 
+        Engine engine() const noexcept;
+
+        // Expanded FIPS-197 schedule, 16 bytes per round key (for the hardware/bitsliced backends)
+        std::span<const uint8_t> roundKeys() const noexcept;
+
     private:
         std::array<uint8_t, MAX_AES_SCHEDULE_SIZE> m_roundKeys = {};
         size_t m_keySizeBytes;
+        Engine m_engine;
+
+        // T-table schedules as big-endian column words; decryption keys are reversed
+        // and run through InvMixColumns for the equivalent inverse cipher
+        std::array<uint32_t, MAX_AES_SCHEDULE_SIZE / 4> m_encKeys = {};
+        std::array<uint32_t, MAX_AES_SCHEDULE_SIZE / 4> m_decKeys = {};
 
+        size_t rounds() const noexcept;
 
         void keyExpansion(const Bytes& key);
+        void tableKeySchedule();
+
+        void encryptReference(const uint8_t* in, uint8_t* out) const;
+        void decryptReference(const uint8_t* in, uint8_t* out) const;
+        void encryptTTable(const uint8_t* in, uint8_t* out) const;
+        void decryptTTable(const uint8_t* in, uint8_t* out) const;
 
     private:
         using State = uint8_t[4][4];
@@ -0,0 +1,432 @@
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+
+#include "crypto/modern/symmetric/block/AESBitsliced.h"
+#include "crypto/core/utils.h"
+
+// Layout: plane q[b] holds bit b of every state byte of 4 blocks. Byte (row, col) of block k
+// sits at bit row*16 + col*4 + k, so a state row is one 16-bit lane and a column step is 4 bits.
+
+namespace {
+    using Planes = uint64_t[8];
+
+    using crypto::core::utils::secure_zeroize;
+
+    inline uint64_t rotr(uint64_t x, int n) { return (x >> n) | (x << (64 - n)); }
+
+    // Boyar-Peralta S-box circuit (113 gates). q[0] is the least significant bit plane.
+    void sbox(uint64_t* q) {
+        uint64_t x0 = q[7], x1 = q[6], x2 = q[5], x3 = q[4];
+        uint64_t x4 = q[3], x5 = q[2], x6 = q[1], x7 = q[0];
+
+        // Top linear transformation
+        uint64_t y14 = x3 ^ x5;
+        uint64_t y13 = x0 ^ x6;
+        uint64_t y9  = x0 ^ x3;
+        uint64_t y8  = x0 ^ x5;
+        uint64_t t0  = x1 ^ x2;
+        uint64_t y1  = t0 ^ x7;
+        uint64_t y4  = y1 ^ x3;
+        uint64_t y12 = y13 ^ y14;
+        uint64_t y2  = y1 ^ x0;
+        uint64_t y5  = y1 ^ x6;
+        uint64_t y3  = y5 ^ y8;
+        uint64_t t1  = x4 ^ y12;
+        uint64_t y15 = t1 ^ x5;
+        uint64_t y20 = t1 ^ x1;
+        uint64_t y6  = y15 ^ x7;
+        uint64_t y10 = y15 ^ t0;
+        uint64_t y11 = y20 ^ y9;
+        uint64_t y7  = x7 ^ y11;
+        uint64_t y17 = y10 ^ y11;
+        uint64_t y19 = y10 ^ y8;
+        uint64_t y16 = t0 ^ y11;
+        uint64_t y21 = y13 ^ y16;
+        uint64_t y18 = x0 ^ y16;
+
+        // Non-linear section (GF(2^8) inversion)
+        uint64_t t2  = y12 & y15;
+        uint64_t t3  = y3 & y6;
+        uint64_t t4  = t3 ^ t2;
+        uint64_t t5  = y4 & x7;
+        uint64_t t6  = t5 ^ t2;
+        uint64_t t7  = y13 & y16;
+        uint64_t t8  = y5 & y1;
+        uint64_t t9  = t8 ^ t7;
+        uint64_t t10 = y2 & y7;
+        uint64_t t11 = t10 ^ t7;
+        uint64_t t12 = y9 & y11;
+        uint64_t t13 = y14 & y17;
+        uint64_t t14 = t13 ^ t12;
+        uint64_t t15 = y8 & y10;
+        uint64_t t16 = t15 ^ t12;
+        uint64_t t17 = t4 ^ t14;
+        uint64_t t18 = t6 ^ t16;
+        uint64_t t19 = t9 ^ t14;
+        uint64_t t20 = t11 ^ t16;
+        uint64_t t21 = t17 ^ y20;
+        uint64_t t22 = t18 ^ y19;
+        uint64_t t23 = t19 ^ y21;
+        uint64_t t24 = t20 ^ y18;
+
+        uint64_t t25 = t21 ^ t22;
+        uint64_t t26 = t21 & t23;
+        uint64_t t27 = t24 ^ t26;
+        uint64_t t28 = t25 & t27;
+        uint64_t t29 = t28 ^ t22;
+        uint64_t t30 = t23 ^ t24;
+        uint64_t t31 = t22 ^ t26;
+        uint64_t t32 = t31 & t30;
+        uint64_t t33 = t32 ^ t24;
+        uint64_t t34 = t23 ^ t33;
+        uint64_t t35 = t27 ^ t33;
+        uint64_t t36 = t24 & t35;
+        uint64_t t37 = t36 ^ t34;
+        uint64_t t38 = t27 ^ t36;
+        uint64_t t39 = t29 & t38;
+        uint64_t t40 = t25 ^ t39;
+
+        uint64_t t41 = t40 ^ t37;
+        uint64_t t42 = t29 ^ t33;
+        uint64_t t43 = t29 ^ t40;
+        uint64_t t44 = t33 ^ t37;
+        uint64_t t45 = t42 ^ t41;
+        uint64_t z0  = t44 & y15;
+        uint64_t z1  = t37 & y6;
+        uint64_t z2  = t33 & x7;
+        uint64_t z3  = t43 & y16;
+        uint64_t z4  = t40 & y1;
+        uint64_t z5  = t29 & y7;
+        uint64_t z6  = t42 & y11;
+        uint64_t z7  = t45 & y17;
+        uint64_t z8  = t41 & y10;
+        uint64_t z9  = t44 & y12;
+        uint64_t z10 = t37 & y3;
+        uint64_t z11 = t33 & y4;
+        uint64_t z12 = t43 & y13;
+        uint64_t z13 = t40 & y5;
+        uint64_t z14 = t29 & y2;
+        uint64_t z15 = t42 & y9;
+        uint64_t z16 = t45 & y14;
+        uint64_t z17 = t41 & y8;
+
+        // Bottom linear transformation (includes the affine constant 0x63)
+        uint64_t t46 = z15 ^ z16;
+        uint64_t t47 = z10 ^ z11;
+        uint64_t t48 = z5 ^ z13;
+        uint64_t t49 = z9 ^ z10;
+        uint64_t t50 = z2 ^ z12;
+        uint64_t t51 = z2 ^ z5;
+        uint64_t t52 = z7 ^ z8;
+        uint64_t t53 = z0 ^ z3;
+        uint64_t t54 = z6 ^ z7;
+        uint64_t t55 = z16 ^ z17;
+        uint64_t t56 = z12 ^ t48;
+        uint64_t t57 = t50 ^ t53;
+        uint64_t t58 = z4 ^ t46;
+        uint64_t t59 = z3 ^ t54;
+        uint64_t t60 = t46 ^ t57;
+        uint64_t t61 = z14 ^ t57;
+        uint64_t t62 = t52 ^ t58;
+        uint64_t t63 = t49 ^ t58;
+        uint64_t t64 = z4 ^ t59;
+        uint64_t t65 = t61 ^ t62;
+        uint64_t t66 = z1 ^ t63;
+        uint64_t s0  = t59 ^ t63;
+        uint64_t s6  = t56 ^ ~t62;
+        uint64_t s7  = t48 ^ ~t60;
+        uint64_t t67 = t64 ^ t65;
+        uint64_t s3  = t53 ^ t66;
+        uint64_t s4  = t51 ^ t66;
+        uint64_t s5  = t47 ^ t65;
+        uint64_t s1  = t64 ^ ~s3;
+        uint64_t s2  = t55 ^ ~t67;
+
+        q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+        q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+    }
+
+    // x -> A^-1(x ^ 0x63), the inverse of the S-box's affine step
+    void inv_affine(uint64_t* q) {
+        uint64_t a[8];
+        for (int b = 0; b < 8; ++b) a[b] = q[b];
+        a[0] = ~a[0]; a[1] = ~a[1]; a[5] = ~a[5]; a[6] = ~a[6];
+
+        for (int b = 0; b < 8; ++b) q[b] = a[(b + 2) & 7] ^ a[(b + 5) & 7] ^ a[(b + 7) & 7];
+    }
+
+    // InvSubBytes(x) = A^-1(S(A^-1(x ^ 0x63)) ^ 0x63), since GF(2^8) inversion is an involution
+    void inv_sbox(uint64_t* q) {
+        inv_affine(q);
+        sbox(q);
+        inv_affine(q);
+    }
+
+    inline uint64_t shift_rows(uint64_t x) {
+        return (x & 0x000000000000FFFFull)
+            | ((x >> 4)  & 0x000000000FFF0000ull) | ((x << 12) & 0x00000000F0000000ull)
+            | ((x >> 8)  & 0x000000FF00000000ull) | ((x << 8)  & 0x0000FF0000000000ull)
+            | ((x >> 12) & 0x000F000000000000ull) | ((x << 4)  & 0xFFF0000000000000ull);
+    }
+
+    inline uint64_t inv_shift_rows(uint64_t x) {
+        return (x & 0x000000000000FFFFull)
+            | ((x << 4)  & 0x00000000FFF00000ull) | ((x >> 12) & 0x00000000000F0000ull)
+            | ((x >> 8)  & 0x000000FF00000000ull) | ((x << 8)  & 0x0000FF0000000000ull)
+            | ((x << 12) & 0xF000000000000000ull) | ((x >> 4)  & 0x0FFF000000000000ull);
+    }
+
+    // Multiplication by x in GF(2^8) on bit planes
+    inline void xtime(const uint64_t* a, uint64_t* o) {
+        o[0] = a[7];
+        o[1] = a[0] ^ a[7];
+        o[2] = a[1];
+        o[3] = a[2] ^ a[7];
+        o[4] = a[3] ^ a[7];
+        o[5] = a[4];
+        o[6] = a[5];
+        o[7] = a[6];
+    }
+
+    // Rotating a plane by 16 bits moves row r+1 onto row r
+    void mix_columns(uint64_t* q) {
+        uint64_t r1[8], t[8], x2[8];
+        for (int b = 0; b < 8; ++b) {
+            r1[b] = rotr(q[b], 16);
+            t[b] = q[b] ^ r1[b];
+        }
+        xtime(t, x2);
+        for (int b = 0; b < 8; ++b) q[b] = x2[b] ^ r1[b] ^ rotr(t[b], 32);
+    }
+
+    // InvMixColumns = MixColumns after a ^= 4 * (a ^ a[row + 2])
+    void inv_mix_columns(uint64_t* q) {
+        uint64_t u[8], x2[8], x4[8];
+        for (int b = 0; b < 8; ++b) u[b] = q[b] ^ rotr(q[b], 32);
+        xtime(u, x2);
+        xtime(x2, x4);
+        for (int b = 0; b < 8; ++b) q[b] ^= x4[b];
+        mix_columns(q);
+    }
+
+    inline size_t bit_index(size_t byte, size_t block) {
+        return (byte & 3) * 16 + (byte >> 2) * 4 + block;
+    }
+
+    // Transposes an 8x8 bit matrix held one row per byte
+    inline uint64_t transpose8x8(uint64_t x) {
+        uint64_t t;
+        t = (x ^ (x >> 7))  & 0x00AA00AA00AA00AAull; x ^= t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull; x ^= t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull; x ^= t ^ (t << 28);
+        return x;
+    }
+
+    // Byte offset (block * 16 + column * 4 + row) of plane bit idx
+    inline size_t byte_offset(size_t idx) {
+        return (idx & 3) * 16 + ((idx >> 2) & 3) * 4 + (idx >> 4);
+    }
+
+    // Gathers the 64 state bytes into words in plane-bit order, then transposes each word so
+    // byte b holds bit b of 8 consecutive plane positions
+    void load_planes(const uint8_t* in, size_t blocks, uint64_t* q) {
+        for (int b = 0; b < 8; ++b) q[b] = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            uint64_t w = 0;
+            for (size_t i = 0; i < 8; ++i) {
+                size_t idx = 8 * j + i;
+                if ((idx & 3) < blocks) w |= uint64_t(in[byte_offset(idx)]) << (8 * i);
+            }
+            w = transpose8x8(w);
+            for (int b = 0; b < 8; ++b) q[b] |= ((w >> (8 * b)) & 0xFF) << (8 * j);
+        }
+    }
+
+    void store_planes(const uint64_t* q, size_t blocks, uint8_t* out) {
+        for (size_t j = 0; j < 8; ++j) {
+            uint64_t w = 0;
+            for (int b = 0; b < 8; ++b) w |= ((q[b] >> (8 * j)) & 0xFF) << (8 * b);
+            w = transpose8x8(w);
+            for (size_t i = 0; i < 8; ++i) {
+                size_t idx = 8 * j + i;
+                if ((idx & 3) < blocks) out[byte_offset(idx)] = static_cast<uint8_t>(w >> (8 * i));
+            }
+        }
+    }
+
+    // SubWord without table lookups: the 4 bytes go through the S-box circuit as bit lanes 0..3
+    uint32_t sub_word(uint32_t w) {
+        uint64_t q[8];
+        for (int b = 0; b < 8; ++b) {
+            q[b] = 0;
+            for (int i = 0; i < 4; ++i) q[b] |= static_cast<uint64_t>((w >> (8 * i + b)) & 1) << i;
+        }
+        sbox(q);
+
+        uint32_t r = 0;
+        for (int b = 0; b < 8; ++b) {
+            for (int i = 0; i < 4; ++i) r |= static_cast<uint32_t>((q[b] >> i) & 1) << (8 * i + b);
+        }
+        return r;
+    }
+
+    constexpr uint8_t RCON[11] = { 0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 };
+
+    constexpr size_t GROUP_BLOCKS = 4;   // blocks per 64-bit plane
+    constexpr size_t GROUPS = crypto::modern::block::symmetric::AESBitsliced::BATCH_BLOCKS / GROUP_BLOCKS;
+
+    void add_round_key(uint64_t* q, const uint64_t* rk) {
+        for (size_t g = 0; g < GROUPS; ++g)
+            for (int b = 0; b < 8; ++b) q[8 * g + b] ^= rk[b];
+    }
+
+    // Up to BATCH_BLOCKS blocks; missing blocks are processed as zeros and not written
+    void encrypt_batch(const uint64_t* keys, size_t rounds, const uint8_t* in, uint8_t* out, size_t blocks) {
+        uint64_t q[8 * GROUPS];
+        for (size_t g = 0; g < GROUPS; ++g) {
+            size_t first = g * GROUP_BLOCKS;
+            size_t count = blocks > first ? std::min(GROUP_BLOCKS, blocks - first) : 0;
+            load_planes(in + 16 * first, count, q + 8 * g);
+        }
+
+        add_round_key(q, keys);
+        for (size_t round = 1; round <= rounds; ++round) {
+            for (size_t g = 0; g < GROUPS; ++g) {
+                uint64_t* p = q + 8 * g;
+                sbox(p);
+                for (int b = 0; b < 8; ++b) p[b] = shift_rows(p[b]);
+                if (round != rounds) mix_columns(p);
+            }
+            add_round_key(q, keys + 8 * round);
+        }
+
+        for (size_t g = 0; g < GROUPS; ++g) {
+            size_t first = g * GROUP_BLOCKS;
+            size_t count = blocks > first ? std::min(GROUP_BLOCKS, blocks - first) : 0;
+            store_planes(q + 8 * g, count, out + 16 * first);
+        }
+        secure_zeroize(q, sizeof(q));
+    }
+
+    void decrypt_batch(const uint64_t* keys, size_t rounds, const uint8_t* in, uint8_t* out, size_t blocks) {
+        uint64_t q[8 * GROUPS];
+        for (size_t g = 0; g < GROUPS; ++g) {
+            size_t first = g * GROUP_BLOCKS;
+            size_t count = blocks > first ? std::min(GROUP_BLOCKS, blocks - first) : 0;
+            load_planes(in + 16 * first, count, q + 8 * g);
+        }
+
+        add_round_key(q, keys + 8 * rounds);
+        for (size_t round = rounds; round-- > 0;) {
+            for (size_t g = 0; g < GROUPS; ++g) {
+                uint64_t* p = q + 8 * g;
+                for (int b = 0; b < 8; ++b) p[b] = inv_shift_rows(p[b]);
+                inv_sbox(p);
+            }
+            add_round_key(q, keys + 8 * round);
+            if (round != 0) {
+                for (size_t g = 0; g < GROUPS; ++g) inv_mix_columns(q + 8 * g);
+            }
+        }
+
+        for (size_t g = 0; g < GROUPS; ++g) {
+            size_t first = g * GROUP_BLOCKS;
+            size_t count = blocks > first ? std::min(GROUP_BLOCKS, blocks - first) : 0;
+            store_planes(q + 8 * g, count, out + 16 * first);
+        }
+        secure_zeroize(q, sizeof(q));
+    }
+}
+
+
+namespace crypto::modern::block::symmetric {
+
+    AESBitsliced::AESBitsliced(size_t keySizeBytes): m_keySizeBytes(keySizeBytes), m_rounds(keySizeBytes / 4 + 6) {
+        if (keySizeBytes != 16 && keySizeBytes != 24 && keySizeBytes != 32) {
+            throw std::invalid_argument("Invalid AES key size");
+        }
+    }
+
+    AESBitsliced::~AESBitsliced() {
+        secure_zeroize(m_planeKeys.data(), m_planeKeys.size() * sizeof(uint64_t));
+    }
+
+    void AESBitsliced::setKey(const Bytes& key) {
+        if (key.size() != m_keySizeBytes) {
+            throw std::invalid_argument("Key size does not match the initialized size");
+        }
+
+        // FIPS-197 key expansion on big-endian words
+        const size_t Nk = m_keySizeBytes / 4;
+        const size_t totalWords = 4 * (m_rounds + 1);
+        uint32_t w[60];
+
+        for (size_t i = 0; i < Nk; ++i) {
+            w[i] = (uint32_t(key[4 * i]) << 24) | (uint32_t(key[4 * i + 1]) << 16) |
+                   (uint32_t(key[4 * i + 2]) << 8) | uint32_t(key[4 * i + 3]);
+        }
+        for (size_t i = Nk; i < totalWords; ++i) {
+            uint32_t temp = w[i - 1];
+            if (i % Nk == 0) {
+                temp = sub_word((temp << 8) | (temp >> 24)) ^ (uint32_t(RCON[i / Nk]) << 24);
+            } else if (Nk > 6 && i % Nk == 4) {
+                temp = sub_word(temp);
+            }
+            w[i] = w[i - Nk] ^ temp;
+        }
+
+        // Spread every key bit over the 4 block lanes of its byte position
+        for (size_t round = 0; round <= m_rounds; ++round) {
+            uint64_t* rk = m_planeKeys.data() + 8 * round;
+            for (int b = 0; b < 8; ++b) rk[b] = 0;
+
+            for (size_t p = 0; p < 16; ++p) {
+                uint64_t byte = (w[4 * round + p / 4] >> (24 - 8 * (p % 4))) & 0xFF;
+                uint64_t lanes = 0xFull << bit_index(p, 0);
+                for (int b = 0; b < 8; ++b) rk[b] |= (0 - ((byte >> b) & 1)) & lanes;
+            }
+        }
+
+        secure_zeroize(w, sizeof(w));
+    }
+
+    void AESBitsliced::encryptBlock(const Bytes& plaintext, Bytes& output) const {
+        if (plaintext.size() != 16) throw std::invalid_argument("Block size error");
+        output.resize(16);
+        encryptBlocks(plaintext, output, 1);
+    }
+
+    void AESBitsliced::decryptBlock(const Bytes& ciphertext, Bytes& output) const {
+        if (ciphertext.size() != 16) throw std::invalid_argument("Block size error");
+        output.resize(16);
+        decryptBlocks(ciphertext, output, 1);
+    }
+
+    void AESBitsliced::encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+        for (size_t i = 0; i < nblocks; i += BATCH_BLOCKS) {
+            size_t count = std::min(BATCH_BLOCKS, nblocks - i);
+            encrypt_batch(m_planeKeys.data(), m_rounds, in.data() + 16 * i, out.data() + 16 * i, count);
+        }
+    }
+
+    void AESBitsliced::decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+        for (size_t i = 0; i < nblocks; i += BATCH_BLOCKS) {
+            size_t count = std::min(BATCH_BLOCKS, nblocks - i);
+            decrypt_batch(m_planeKeys.data(), m_rounds, in.data() + 16 * i, out.data() + 16 * i, count);
+        }
+    }
+
+    size_t AESBitsliced::blockSize() const noexcept {
+        return 16;
+    }
+
+    size_t AESBitsliced::keySize() const noexcept {
+        return m_keySizeBytes;
+    }
+
+} // namespace crypto::modern::block::symmetric
@@ -0,0 +1,42 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+
+namespace crypto::modern::block::symmetric{
+
+    using crypto::core::Bytes;
+
+    // Constant-time AES: no table lookups and no secret-dependent branches, key schedule included.
+    // Blocks are transposed into bit planes (one uint64_t per bit of 4 blocks) and the S-box is
+    // evaluated as a Boolean circuit, so work is done in batches of BATCH_BLOCKS.
+    class AESBitsliced final : public crypto::core::symmetric::IBlockCipher{
+    public:
+        static constexpr size_t BATCH_BLOCKS = 8;
+
+        explicit AESBitsliced(size_t keySizeBytes);
+        ~AESBitsliced() override;
+
+        void setKey(const Bytes& key) override;
+
+        // Single blocks cost a full batch; prefer encryptBlocks for bulk data
+        void encryptBlock(const Bytes& plaintext, Bytes& output) const override;
+        void decryptBlock(const Bytes& ciphertext, Bytes& output) const override;
+
+        void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+        void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+
+        size_t blockSize() const noexcept override;
+        size_t keySize() const noexcept override;
+
+    private:
+        size_t m_keySizeBytes;
+        size_t m_rounds;
+
+        // Round keys in bit-plane form, 8 words per round, replicated for the 4 blocks of a word
+        std::array<uint64_t, 15 * 8> m_planeKeys = {};
+    };
+
+} // namespace crypto::modern::block::symmetric
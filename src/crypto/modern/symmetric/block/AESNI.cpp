@@ -0,0 +1,161 @@
+#include <stdexcept>
+#include <cstring>
+
+#include "crypto/modern/symmetric/block/AESNI.h"
+#include "crypto/core/utils.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CRYPTO_HAS_AESNI 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define AESNI_TARGET
+    #else
+        #include <cpuid.h>
+        // Compile just these functions for AES-NI; the rest of the build keeps its baseline ISA
+        #define AESNI_TARGET __attribute__((target("aes,sse2")))
+    #endif
+#else
+    #define CRYPTO_HAS_AESNI 0
+#endif
+
+
+namespace {
+    using crypto::core::utils::secure_zeroize;
+
+#if CRYPTO_HAS_AESNI
+    bool cpuHasAesNi() {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuid(regs, 1);
+        return (regs[2] & (1 << 25)) != 0;
+    #else
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+        return (ecx & bit_AES) != 0;
+    #endif
+    }
+
+    AESNI_TARGET void invertKeys(const uint8_t* enc, uint8_t* dec, size_t rounds) {
+        const __m128i* ek = reinterpret_cast<const __m128i*>(enc);
+        __m128i* dk = reinterpret_cast<__m128i*>(dec);
+
+        dk[0] = _mm_load_si128(ek + rounds);
+        for (size_t r = 1; r < rounds; ++r) dk[r] = _mm_aesimc_si128(_mm_load_si128(ek + rounds - r));
+        dk[rounds] = _mm_load_si128(ek);
+    }
+
+    // N independent blocks per round so consecutive aesenc/aesdec do not wait on each other
+    template <size_t N, bool Encrypt>
+    AESNI_TARGET inline void cryptN(const uint8_t* keys, size_t rounds, const uint8_t* in, uint8_t* out) {
+        const __m128i* rk = reinterpret_cast<const __m128i*>(keys);
+        __m128i b[N];
+
+        __m128i k = _mm_load_si128(rk);
+        for (size_t i = 0; i < N; ++i) b[i] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in) + i), k);
+
+        for (size_t r = 1; r < rounds; ++r) {
+            k = _mm_load_si128(rk + r);
+            for (size_t i = 0; i < N; ++i) b[i] = Encrypt ? _mm_aesenc_si128(b[i], k) : _mm_aesdec_si128(b[i], k);
+        }
+
+        k = _mm_load_si128(rk + rounds);
+        for (size_t i = 0; i < N; ++i) {
+            b[i] = Encrypt ? _mm_aesenclast_si128(b[i], k) : _mm_aesdeclast_si128(b[i], k);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + i, b[i]);
+        }
+    }
+
+    template <bool Encrypt>
+    AESNI_TARGET void cryptBlocks(const uint8_t* keys, size_t rounds, const uint8_t* in, uint8_t* out, size_t nblocks) {
+        constexpr size_t W = crypto::modern::block::symmetric::AESNI::PARALLEL_BLOCKS;
+
+        size_t i = 0;
+        for (; i + W <= nblocks; i += W) cryptN<W, Encrypt>(keys, rounds, in + 16 * i, out + 16 * i);
+        for (; i + 4 <= nblocks; i += 4) cryptN<4, Encrypt>(keys, rounds, in + 16 * i, out + 16 * i);
+        for (; i < nblocks; ++i)         cryptN<1, Encrypt>(keys, rounds, in + 16 * i, out + 16 * i);
+    }
+#endif
+}
+
+
+namespace crypto::modern::block::symmetric {
+
+    AESNI::AESNI(size_t keySizeBytes)
+        : m_portable(keySizeBytes, AES::Engine::Reference)
+        , m_hardware(isSupported())
+        , m_rounds(keySizeBytes / 4 + 6) {
+    }
+
+    AESNI::~AESNI() {
+        secure_zeroize(m_encKeys.data(), m_encKeys.size());
+        secure_zeroize(m_decKeys.data(), m_decKeys.size());
+    }
+
+    bool AESNI::isSupported() noexcept {
+#if CRYPTO_HAS_AESNI
+        static const bool supported = cpuHasAesNi();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    bool AESNI::usesHardware() const noexcept {
+        return m_hardware;
+    }
+
+    void AESNI::setKey(const Bytes& key) {
+        m_portable.setKey(key);
+
+#if CRYPTO_HAS_AESNI
+        if (m_hardware) {
+            // FIPS-197 round keys are already in the byte order AES-NI works on
+            auto schedule = m_portable.roundKeys();
+            std::memcpy(m_encKeys.data(), schedule.data(), schedule.size());
+            invertKeys(m_encKeys.data(), m_decKeys.data(), m_rounds);
+        }
+#endif
+    }
+
+    void AESNI::encryptBlock(const Bytes& plaintext, Bytes& output) const {
+        if (plaintext.size() != 16) throw std::invalid_argument("Block size error");
+        output.resize(16);
+        encryptBlocks(plaintext, output, 1);
+    }
+
+    void AESNI::decryptBlock(const Bytes& ciphertext, Bytes& output) const {
+        if (ciphertext.size() != 16) throw std::invalid_argument("Block size error");
+        output.resize(16);
+        decryptBlocks(ciphertext, output, 1);
+    }
+
+    void AESNI::encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+#if CRYPTO_HAS_AESNI
+        if (m_hardware) return cryptBlocks<true>(m_encKeys.data(), m_rounds, in.data(), out.data(), nblocks);
+#endif
+
+        m_portable.encryptBlocks(in, out, nblocks);
+    }
+
+    void AESNI::decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 16 || out.size() < nblocks * 16) throw std::invalid_argument("Block size error");
+
+#if CRYPTO_HAS_AESNI
+        if (m_hardware) return cryptBlocks<false>(m_decKeys.data(), m_rounds, in.data(), out.data(), nblocks);
+#endif
+
+        m_portable.decryptBlocks(in, out, nblocks);
+    }
+
+    size_t AESNI::blockSize() const noexcept {
+        return 16;
+    }
+
+    size_t AESNI::keySize() const noexcept {
+        return m_portable.keySize();
+    }
+
+} // namespace crypto::modern::block::symmetric
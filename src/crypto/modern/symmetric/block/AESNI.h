@@ -0,0 +1,48 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+#include "crypto/modern/symmetric/block/AES.h"
+
+namespace crypto::modern::block::symmetric{
+
+    using crypto::core::Bytes;
+
+    // AES on the x86 AES-NI instructions. CPUID is checked once at construction;
+    // without AES-NI every call goes to the reference AES engine, never the cache-timing-prone
+    // T-table one (use AESBitsliced directly for a constant-time software path).
+    class AESNI final : public crypto::core::symmetric::IBlockCipher{
+    public:
+        // Blocks kept in flight by encryptBlocks/decryptBlocks to hide aesenc latency
+        static constexpr size_t PARALLEL_BLOCKS = 8;
+
+        explicit AESNI(size_t keySizeBytes);
+        ~AESNI() override;
+
+        static bool isSupported() noexcept;
+        bool usesHardware() const noexcept;
+
+        void setKey(const Bytes& key) override;
+
+        void encryptBlock(const Bytes& plaintext, Bytes& output) const override;
+        void decryptBlock(const Bytes& ciphertext, Bytes& output) const override;
+
+        void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+        void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+
+        size_t blockSize() const noexcept override;
+        size_t keySize() const noexcept override;
+
+    private:
+        AES m_portable;
+        bool m_hardware;
+
+        // Round keys in the byte order aesenc expects; decryption keys are reversed and run through aesimc
+        alignas(16) std::array<uint8_t, MAX_AES_SCHEDULE_SIZE> m_encKeys = {};
+        alignas(16) std::array<uint8_t, MAX_AES_SCHEDULE_SIZE> m_decKeys = {};
+        size_t m_rounds;
+    };
+
+} // namespace crypto::modern::block::symmetric
@@ -1,31 +1,123 @@
 #include "DES.h"
+#include "DESTables.h"
 #include <stdexcept>
 #include <algorithm>
+#include <array>
 
 namespace {
-    // --- DES Permutation Tables ---
-    const uint8_t IP[] = { 58, 50, 42, 34, 26, 18, 10, 2, 60, 52, 44, 36, 28, 20, 12, 4, 62, 54, 46, 38, 30, 22, 14, 6, 64, 56, 48, 40, 32, 24, 16, 8, 57, 49, 41, 33, 25, 17, 9, 1, 59, 51, 43, 35, 27, 19, 11, 3, 61, 53, 45, 37, 29, 21, 13, 5, 63, 55, 47, 39, 31, 23, 15, 7 };
-    const uint8_t FP[] = { 40, 8, 48, 16, 56, 24, 64, 32, 39, 7, 47, 15, 55, 23, 63, 31, 38, 6, 46, 14, 54, 22, 62, 30, 37, 5, 45, 13, 53, 21, 61, 29, 36, 4, 44, 12, 52, 20, 60, 28, 35, 3, 43, 11, 51, 19, 59, 27, 34, 2, 42, 10, 50, 18, 58, 26, 33, 1, 41, 9, 49, 17, 57, 25 };
-    const uint8_t E[]  = { 32, 1, 2, 3, 4, 5, 4, 5, 6, 7, 8, 9, 8, 9, 10, 11, 12, 13, 12, 13, 14, 15, 16, 17, 16, 17, 18, 19, 20, 21, 20, 21, 22, 23, 24, 25, 24, 25, 26, 27, 28, 29, 28, 29, 30, 31, 32, 1 };
-    const uint8_t P[]  = { 16, 7, 20, 21, 29, 12, 28, 17, 1, 15, 23, 26, 5, 18, 31, 10, 2, 8, 24, 14, 32, 27, 3, 9, 19, 13, 30, 6, 22, 11, 4, 25 };
-    const uint8_t PC1[] = { 57, 49, 41, 33, 25, 17, 9, 1, 58, 50, 42, 34, 26, 18, 10, 2, 59, 51, 43, 35, 27, 19, 11, 3, 60, 52, 44, 36, 63, 55, 47, 39, 31, 23, 15, 7, 62, 54, 46, 38, 30, 22, 14, 6, 61, 53, 45, 37, 29, 21, 13, 5, 28, 20, 12, 4 };
-    const uint8_t PC2[] = { 14, 17, 11, 24, 1, 5, 3, 28, 15, 6, 21, 10, 23, 19, 12, 4, 26, 8, 16, 7, 27, 20, 13, 2, 41, 52, 31, 37, 47, 55, 30, 40, 51, 45, 33, 48, 44, 49, 39, 56, 34, 53, 46, 42, 50, 36, 29, 32 };
-    const uint8_t shifts[] = { 1, 1, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1 };
-    const uint8_t S[8][64] = {
-        {14,4,13,1,2,15,11,8,3,10,6,12,5,9,0,7,0,15,7,4,14,2,13,1,10,6,12,11,9,5,3,8,4,1,14,8,13,6,2,11,15,12,9,7,3,10,5,0,15,12,8,2,4,9,1,7,5,11,3,14,10,0,6,13},
-        {15,1,8,14,6,11,3,4,9,7,2,13,12,0,5,10,3,13,4,7,15,2,8,14,12,0,1,10,6,9,11,5,0,14,7,11,10,4,13,1,5,8,12,6,9,3,2,15,13,8,10,1,3,15,4,2,11,6,7,12,0,5,14,9},
-        {10,0,9,14,6,3,15,5,1,13,12,7,11,4,2,8,13,7,0,9,3,4,6,10,2,8,5,14,12,11,15,1,13,6,4,9,8,15,3,0,11,1,2,12,5,10,14,7,1,10,13,0,6,9,8,7,4,15,14,3,11,5,2,12},
-        {7,13,14,3,0,6,9,10,1,2,8,5,11,12,4,15,13,8,11,5,6,15,0,3,4,7,2,12,1,10,14,9,10,6,9,0,12,11,7,13,15,1,3,14,5,2,8,4,3,15,0,6,10,1,13,8,9,4,5,11,12,7,2,14},
-        {2,12,4,1,7,10,11,6,8,5,3,15,13,0,14,9,14,11,2,12,4,7,13,1,5,0,15,10,3,9,8,6,4,2,1,11,10,13,7,8,15,9,12,5,6,3,0,14,11,8,12,7,1,14,2,13,6,15,0,9,10,4,5,3},
-        {12,1,10,15,9,2,6,8,0,13,3,4,14,7,5,11,10,15,4,2,7,12,9,5,6,1,13,14,0,11,3,8,9,14,15,5,2,8,12,3,7,0,4,10,1,13,11,6,4,3,2,12,9,5,15,10,11,14,1,7,6,0,8,13},
-        {4,11,2,14,15,0,8,13,3,12,9,7,5,10,6,1,13,0,11,7,4,9,1,10,14,3,5,12,2,15,8,6,1,4,11,13,12,3,7,14,10,15,6,8,0,5,9,2,6,11,13,8,1,4,10,7,9,5,0,15,14,2,3,12},
-        {13,2,8,4,6,15,11,1,10,9,3,14,5,0,12,7,1,15,13,8,10,3,7,4,12,5,6,11,0,14,9,2,7,11,4,1,9,12,14,2,0,6,10,13,15,3,5,8,2,1,14,7,4,10,8,13,15,12,9,0,3,5,6,11}
-    };
+    using namespace crypto::modern::block::symmetric::des_tables;
+
+    constexpr uint32_t rotl(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+    constexpr uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    // SP[i][chunk]: S-box i applied to a 6-bit chunk, moved to its output nibble, passed
+    // through P and rotated left by one to match the rotated halves the SP-box rounds keep
+    using SPTable = std::array<std::array<uint32_t, 64>, 8>;
+
+    constexpr SPTable makeSP() {
+        SPTable sp{};
+        for (int i = 0; i < 8; i++) {
+            for (uint32_t chunk = 0; chunk < 64; chunk++) {
+                uint32_t row = ((chunk & 0x20) >> 4) | (chunk & 0x01);
+                uint32_t col = (chunk & 0x1E) >> 1;
+                uint32_t sval = static_cast<uint32_t>(S[i][row * 16 + col]) << (28 - 4 * i);
+
+                uint32_t permuted = 0;
+                for (int j = 0; j < 32; j++) {
+                    permuted |= ((sval >> (32 - P[j])) & 0x01) << (31 - j);
+                }
+                sp[i][chunk] = rotl(permuted, 1);
+            }
+        }
+        return sp;
+    }
+
+    constexpr SPTable SP = makeSP();
+
+    // Exchanges the bits of b selected by mask with the bits of a `shift` places above them
+    inline void swapMove(uint32_t& a, uint32_t& b, int shift, uint32_t mask) {
+        uint32_t t = ((a >> shift) ^ b) & mask;
+        b ^= t;
+        a ^= t << shift;
+    }
+
+    // IP as a sequence of swap-moves over the two big-endian halves; leaves both
+    // halves rotated left by one bit
+    inline void initialPermutation(uint32_t& L, uint32_t& R) {
+        swapMove(L, R, 4, 0x0F0F0F0F);
+        swapMove(L, R, 16, 0x0000FFFF);
+        swapMove(R, L, 2, 0x33333333);
+        swapMove(R, L, 8, 0x00FF00FF);
+        R = rotl(R, 1);
+        uint32_t t = (L ^ R) & 0xAAAAAAAA;
+        L ^= t;
+        R ^= t;
+        L = rotl(L, 1);
+    }
+
+    // Exact inverse of initialPermutation
+    inline void finalPermutation(uint32_t& L, uint32_t& R) {
+        L = rotr(L, 1);
+        uint32_t t = (L ^ R) & 0xAAAAAAAA;
+        L ^= t;
+        R ^= t;
+        R = rotr(R, 1);
+        swapMove(R, L, 8, 0x00FF00FF);
+        swapMove(R, L, 2, 0x33333333);
+        swapMove(L, R, 16, 0x0000FFFF);
+        swapMove(L, R, 4, 0x0F0F0F0F);
+    }
+
+    // 16 rounds on N independent blocks at once, so one block's table lookups overlap the
+    // others' instead of waiting on the previous round. Ends with the halves swapped back
+    // into FP's R16 || L16 order.
+    template <size_t N>
+    inline void spRoundsN(const uint32_t* keys, uint32_t* L, uint32_t* R, bool decrypt) {
+        for (int round = 0; round < 16; round++) {
+            const uint32_t* k = keys + 2 * (decrypt ? 15 - round : round);
+            for (size_t i = 0; i < N; i++) {
+                uint32_t u = rotr(R[i], 4) ^ k[0];
+                uint32_t v = R[i] ^ k[1];
+                L[i] ^= SP[0][(u >> 24) & 0x3F] ^ SP[2][(u >> 16) & 0x3F] ^ SP[4][(u >> 8) & 0x3F] ^ SP[6][u & 0x3F] ^
+                        SP[1][(v >> 24) & 0x3F] ^ SP[3][(v >> 16) & 0x3F] ^ SP[5][(v >> 8) & 0x3F] ^ SP[7][v & 0x3F];
+                std::swap(L[i], R[i]);
+            }
+        }
+        for (size_t i = 0; i < N; i++) std::swap(L[i], R[i]);
+    }
+
+    inline uint32_t load32(const uint8_t* in) {
+        return (static_cast<uint32_t>(in[0]) << 24) | (static_cast<uint32_t>(in[1]) << 16) |
+               (static_cast<uint32_t>(in[2]) << 8) | in[3];
+    }
+
+    inline void store32(uint32_t v, uint8_t* out) {
+        out[0] = static_cast<uint8_t>(v >> 24);
+        out[1] = static_cast<uint8_t>(v >> 16);
+        out[2] = static_cast<uint8_t>(v >> 8);
+        out[3] = static_cast<uint8_t>(v);
+    }
+
+    // Blocks are big-endian 64-bit integers
+    inline uint64_t loadBlock(const uint8_t* in) {
+        uint64_t block = 0;
+        for (int i = 0; i < 8; i++) {
+            block = (block << 8) | in[i];
+        }
+        return block;
+    }
+
+    inline void storeBlock(uint64_t block, uint8_t* out) {
+        for (int i = 7; i >= 0; i--) {
+            out[i] = static_cast<uint8_t>(block & 0xFF);
+            block >>= 8;
+        }
+    }
 }
 
 namespace crypto::modern::block::symmetric {
 
-    DES::DES() {
+    DES::DES(Engine engine) : m_engine(engine) {
         m_subkeys.fill(0);
     }
 
@@ -67,9 +159,20 @@ namespace crypto::modern::block::symmetric {
             C = ((C << shift) | (C >> (28 - shift))) & 0x0FFFFFFF;
             D = ((D << shift) | (D >> (28 - shift))) & 0x0FFFFFFF;
             
-            // Combine halves and apply PC2
+            // Combine halves and apply PC2; permute() numbers bits from the top of the
+            // 64-bit word, so the 56-bit C||D has to be left-aligned
             uint64_t combined = (static_cast<uint64_t>(C) << 28) | D;
-            m_subkeys[round] = permute(combined, PC2, 48);
+            m_subkeys[round] = permute(combined << 8, PC2, 48);
+
+            // With R rotated left by one, E's chunks 1,3,5,7 sit on byte boundaries and
+            // chunks 0,2,4,6 do too after a further rotation right by four
+            uint32_t even = 0, odd = 0;
+            for (int i = 0; i < 8; i += 2) {
+                even = (even << 8) | static_cast<uint32_t>((m_subkeys[round] >> (42 - 6 * i)) & 0x3F);
+                odd  = (odd << 8)  | static_cast<uint32_t>((m_subkeys[round] >> (36 - 6 * i)) & 0x3F);
+            }
+            m_spKeys[2 * round] = even;
+            m_spKeys[2 * round + 1] = odd;
         }
     }
 
@@ -104,77 +207,99 @@ namespace crypto::modern::block::symmetric {
         return static_cast<uint32_t>(permute(static_cast<uint64_t>(output) << 32, P, 32));
     }
 
-    void DES::encryptBlock(const Bytes& plaintext, Bytes& ciphertext) const {
-        if (plaintext.size() != 8) {
-            throw std::invalid_argument("DES block must be 8 bytes");
-        }
-        
-        // Convert bytes to 64-bit block (big-endian)
-        uint64_t block = 0;
-        for (int i = 0; i < 8; i++) {
-            block = (block << 8) | static_cast<uint8_t>(plaintext[i]);
-        }
-        
+    uint64_t DES::cryptBlock(uint64_t block, bool decrypt) const {
         // Initial permutation
         block = permute(block, IP, 64);
-        
+
         // Split into 32-bit halves
         uint32_t L = static_cast<uint32_t>(block >> 32);
         uint32_t R = static_cast<uint32_t>(block & 0xFFFFFFFF);
-        
-        // 16 Feistel rounds
+
+        // 16 Feistel rounds (reverse subkey order for decryption)
         for (int round = 0; round < 16; round++) {
             uint32_t temp = R;
-            R = L ^ feistel(R, m_subkeys[round]);
+            R = L ^ feistel(R, m_subkeys[decrypt ? 15 - round : round]);
             L = temp;
         }
-        
+
         // Final permutation (swap not needed due to last round swap)
         uint64_t combined = (static_cast<uint64_t>(R) << 32) | L;
-        uint64_t result = permute(combined, FP, 64);
-        
-        // Convert back to bytes (big-endian)
-        ciphertext.resize(8);
-        for (int i = 0; i < 8; i++) {
-            ciphertext[7 - i] = static_cast<uint8_t>(result & 0xFF);
-            result >>= 8;
+        return permute(combined, FP, 64);
+    }
+
+    void DES::loadHalves(const uint8_t* in, uint32_t* L, uint32_t* R, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            L[i] = load32(in + 8 * i);
+            R[i] = load32(in + 8 * i + 4);
+            initialPermutation(L[i], R[i]);
+        }
+    }
+
+    void DES::storeHalves(const uint32_t* L, const uint32_t* R, uint8_t* out, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            uint32_t l = L[i], r = R[i];
+            finalPermutation(l, r);
+            store32(l, out + 8 * i);
+            store32(r, out + 8 * i + 4);
+        }
+    }
+
+    void DES::spRounds(uint32_t* L, uint32_t* R, size_t n, bool decrypt) const {
+        switch (n) {
+            case 4: return spRoundsN<4>(m_spKeys.data(), L, R, decrypt);
+            case 3: return spRoundsN<3>(m_spKeys.data(), L, R, decrypt);
+            case 2: return spRoundsN<2>(m_spKeys.data(), L, R, decrypt);
+            default: return spRoundsN<1>(m_spKeys.data(), L, R, decrypt);
         }
     }
 
+    void DES::cryptSPBox(const uint8_t* in, uint8_t* out, size_t nblocks, bool decrypt) const {
+        uint32_t L[PARALLEL_BLOCKS], R[PARALLEL_BLOCKS];
+        for (size_t i = 0; i < nblocks; i += PARALLEL_BLOCKS) {
+            size_t n = std::min(PARALLEL_BLOCKS, nblocks - i);
+            loadHalves(in + 8 * i, L, R, n);
+            spRounds(L, R, n, decrypt);
+            storeHalves(L, R, out + 8 * i, n);
+        }
+    }
+
+    void DES::encryptBlock(const Bytes& plaintext, Bytes& ciphertext) const {
+        if (plaintext.size() != 8) {
+            throw std::invalid_argument("DES block must be 8 bytes");
+        }
+        ciphertext.resize(8);
+        encryptBlocks(plaintext, ciphertext, 1);
+    }
+
     void DES::decryptBlock(const Bytes& ciphertext, Bytes& plaintext) const {
         if (ciphertext.size() != 8) {
             throw std::invalid_argument("DES block must be 8 bytes");
         }
-        
-        // Convert bytes to 64-bit block
-        uint64_t block = 0;
-        for (int i = 0; i < 8; i++) {
-            block = (block << 8) | static_cast<uint8_t>(ciphertext[i]);
+        plaintext.resize(8);
+        decryptBlocks(ciphertext, plaintext, 1);
+    }
+
+    void DES::encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 8 || out.size() < nblocks * 8) {
+            throw std::invalid_argument("DES input and output must hold nblocks * 8 bytes");
         }
-        
-        // Initial permutation
-        block = permute(block, IP, 64);
-        
-        // Split into halves
-        uint32_t L = static_cast<uint32_t>(block >> 32);
-        uint32_t R = static_cast<uint32_t>(block & 0xFFFFFFFF);
-        
-        // 16 Feistel rounds in reverse order
-        for (int round = 15; round >= 0; round--) {
-            uint32_t temp = R;
-            R = L ^ feistel(R, m_subkeys[round]);
-            L = temp;
+        if (m_engine == Engine::SPBox) {
+            return cryptSPBox(in.data(), out.data(), nblocks, false);
         }
-        
-        // Final permutation
-        uint64_t combined = (static_cast<uint64_t>(R) << 32) | L;
-        uint64_t result = permute(combined, FP, 64);
-        
-        // Convert back to bytes
-        plaintext.resize(8);
-        for (int i = 0; i < 8; i++) {
-            plaintext[7 - i] = static_cast<uint8_t>(result & 0xFF);
-            result >>= 8;
+        for (size_t i = 0; i < nblocks; i++) {
+            storeBlock(cryptBlock(loadBlock(in.data() + 8 * i), false), out.data() + 8 * i);
         }
     }
-}
\ No newline at end of file
+
+    void DES::decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 8 || out.size() < nblocks * 8) {
+            throw std::invalid_argument("DES input and output must hold nblocks * 8 bytes");
+        }
+        if (m_engine == Engine::SPBox) {
+            return cryptSPBox(in.data(), out.data(), nblocks, true);
+        }
+        for (size_t i = 0; i < nblocks; i++) {
+            storeBlock(cryptBlock(loadBlock(in.data() + 8 * i), true), out.data() + 8 * i);
+        }
+    }
+}
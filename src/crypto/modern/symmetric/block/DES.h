@@ -10,23 +10,54 @@ namespace crypto::modern::block::symmetric {
 
     class DES final : public crypto::core::symmetric::IBlockCipher {
     public:
-        DES();
+        // Reference: table-driven FIPS 46-3 permutations, bit by bit; the default.
+        // SPBox:     S-boxes fused with P into 8x64 tables, swap-move IP/FP, pre-split subkeys.
+        //            Faster, but its 2 KB of key-indexed tables leak through cache timing, so it
+        //            is opt-in. TripleDES always runs on it.
+        enum class Engine { Reference, SPBox };
+
+        // Independent blocks the SP-box engine keeps in flight per round
+        static constexpr size_t PARALLEL_BLOCKS = 4;
+
+        explicit DES(Engine engine = Engine::Reference);
         ~DES() override = default;
 
         void setKey(const Bytes& key) override;
         void encryptBlock(const Bytes& in, Bytes& out) const override;
         void decryptBlock(const Bytes& in, Bytes& out) const override;
 
+        void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+        void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+
         size_t blockSize() const noexcept override { return 8; }
         size_t keySize() const noexcept override { return 8; }
 
+        Engine engine() const noexcept { return m_engine; }
+
     private:
         // 16 subkeys, each 48 bits (stored in 64-bit integers for convenience)
         std::array<uint64_t, 16> m_subkeys{};
 
+        // SP-box schedule: per round the even and odd 6-bit subkey chunks, one per byte,
+        // laid out to line up with the rotated right half (see cryptSPBox)
+        std::array<uint32_t, 32> m_spKeys{};
+        Engine m_engine;
+
         // Core DES functions
         void keyExpansion(uint64_t key);
         uint32_t feistel(uint32_t half_block, uint64_t subkey) const;
+
+        // One block as a big-endian 64-bit integer; decryption runs the subkeys backwards
+        uint64_t cryptBlock(uint64_t block, bool decrypt) const;
+        void cryptSPBox(const uint8_t* in, uint8_t* out, size_t nblocks, bool decrypt) const;
+
+        // SP-box building blocks, also chained by TripleDES. Halves stay in the rotated form
+        // IP leaves them in, and spRounds ends in the order FP expects, so the FP/IP pair
+        // between two passes cancels out. n <= PARALLEL_BLOCKS.
+        friend class TripleDES;
+        static void loadHalves(const uint8_t* in, uint32_t* L, uint32_t* R, size_t n);
+        static void storeHalves(const uint32_t* L, const uint32_t* R, uint8_t* out, size_t n);
+        void spRounds(uint32_t* L, uint32_t* R, size_t n, bool decrypt) const;
         
         // Bit permutation helper
         static uint64_t permute(uint64_t input, const uint8_t* table, int n);
@@ -0,0 +1,249 @@
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "crypto/modern/symmetric/block/DESKeySearch.h"
+#include "crypto/modern/symmetric/block/DESTables.h"
+
+namespace {
+    using namespace crypto::modern::block::symmetric::des_tables;
+
+    // KEY_BITS[r][j]: which bit of the 64-bit key (0 = most significant) becomes bit j of round r's subkey
+    constexpr std::array<std::array<uint8_t, 48>, 16> makeKeyBits() {
+        std::array<std::array<uint8_t, 48>, 16> bits{};
+        int shift = 0;
+        for (int r = 0; r < 16; r++) {
+            shift += shifts[r];
+            for (int j = 0; j < 48; j++) {
+                int pos = PC2[j] - 1;   // position in C || D after this round's rotation
+                int half = pos < 28 ? 0 : 28;
+                int src = half + (pos - half + shift) % 28;
+                bits[r][j] = static_cast<uint8_t>(PC1[src] - 1);
+            }
+        }
+        return bits;
+    }
+
+    // Algebraic normal form of each S-box output bit, by the Moebius transform of its truth table.
+    // Bit m of ANF[s][t] is the coefficient of the monomial made of the input bits set in m
+    // (bit 5 = first input of the chunk); t = 0 is the most significant output bit.
+    constexpr std::array<std::array<uint64_t, 4>, 8> makeANF() {
+        std::array<std::array<uint64_t, 4>, 8> anf{};
+        for (int s = 0; s < 8; s++) {
+            for (int t = 0; t < 4; t++) {
+                uint8_t f[64]{};
+                for (int x = 0; x < 64; x++) {
+                    int row = ((x & 0x20) >> 4) | (x & 0x01);
+                    int col = (x & 0x1E) >> 1;
+                    f[x] = (S[s][row * 16 + col] >> (3 - t)) & 1;
+                }
+                for (int i = 0; i < 6; i++) {
+                    for (int x = 0; x < 64; x++) {
+                        if (x & (1 << i)) f[x] ^= f[x ^ (1 << i)];
+                    }
+                }
+                for (int m = 0; m < 64; m++) anf[s][t] |= static_cast<uint64_t>(f[m]) << m;
+            }
+        }
+        return anf;
+    }
+
+    // P_INV[i]: where P moves bit i of the S-box output
+    constexpr std::array<uint8_t, 32> makePInverse() {
+        std::array<uint8_t, 32> inv{};
+        for (int j = 0; j < 32; j++) inv[P[j] - 1] = static_cast<uint8_t>(j);
+        return inv;
+    }
+
+    constexpr auto KEY_BITS = makeKeyBits();
+    constexpr auto ANF = makeANF();
+    constexpr auto P_INV = makePInverse();
+
+    // Bit j of LANE_BITS[i] is bit i of j: lanes 0..63 enumerate the low six key index bits
+    constexpr uint64_t LANE_BITS[6] = {
+        0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+        0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull
+    };
+
+    inline uint64_t broadcast(uint64_t value, int bit) {
+        return 0 - ((value >> bit) & 1);
+    }
+
+    uint64_t permute64(uint64_t input, const uint8_t* table) {
+        uint64_t result = 0;
+        for (int i = 0; i < 64; i++) result = (result << 1) | ((input >> (64 - table[i])) & 1);
+        return result;
+    }
+
+    uint64_t loadBlock(const crypto::core::Bytes& bytes) {
+        uint64_t block = 0;
+        for (uint8_t b : bytes) block = (block << 8) | b;
+        return block;
+    }
+
+    // Key bit (0 = most significant) to key index bit, or -1 for parity bits
+    constexpr int indexBit(int keyBit) {
+        int byte = keyBit / 8, bit = 7 - keyBit % 8;
+        return bit == 0 ? -1 : 7 * (7 - byte) + bit - 1;
+    }
+
+    // XOR of the monomials in ANF[Box][T], unrolled at compile time
+    template <int Box, int T, size_t... M>
+    inline uint64_t anfOutput(const uint64_t* mono, std::index_sequence<M...>) {
+        uint64_t o = 0;
+        ((o ^= ((ANF[Box][T] >> M) & 1) ? mono[M] : 0), ...);
+        return o;
+    }
+
+    // Each lane's S-box input bit b in in[b]; all 64 monomials are built once and shared by the four outputs
+    template <int Box>
+    inline void sbox(const uint64_t in[6], uint64_t out[4]) {
+        uint64_t mono[64];
+        mono[0] = ~uint64_t{0};
+        for (int m = 1; m < 64; m++) mono[m] = mono[m & (m - 1)] & in[std::countr_zero(static_cast<unsigned>(m))];
+
+        out[0] = anfOutput<Box, 0>(mono, std::make_index_sequence<64>{});
+        out[1] = anfOutput<Box, 1>(mono, std::make_index_sequence<64>{});
+        out[2] = anfOutput<Box, 2>(mono, std::make_index_sequence<64>{});
+        out[3] = anfOutput<Box, 3>(mono, std::make_index_sequence<64>{});
+    }
+
+    template <int Box>
+    inline void sboxRound(int r, const uint64_t* key, const uint64_t* R, uint64_t* L) {
+        uint64_t in[6], out[4];
+        for (int b = 0; b < 6; b++) {
+            int j = 6 * Box + 5 - b;
+            in[b] = R[E[j] - 1] ^ key[KEY_BITS[r][j]];
+        }
+        sbox<Box>(in, out);
+        for (int t = 0; t < 4; t++) L[P_INV[4 * Box + t]] ^= out[t];
+    }
+
+    template <int... Box>
+    inline void feistel(int r, const uint64_t* key, const uint64_t* R, uint64_t* L, std::integer_sequence<int, Box...>) {
+        (sboxRound<Box>(r, key, R, L), ...);
+    }
+}
+
+namespace crypto::modern::block::symmetric {
+
+    DESKeySearch::DESKeySearch(const Bytes& plaintext, const Bytes& ciphertext) {
+        if (plaintext.size() != 8 || ciphertext.size() != 8) {
+            throw std::invalid_argument("DES blocks must be 8 bytes");
+        }
+        m_start = permute64(loadBlock(plaintext), IP);
+        m_target = permute64(loadBlock(ciphertext), IP);
+    }
+
+    uint64_t DESKeySearch::matchLanes(uint64_t base) const {
+        if (base % KEYS_PER_PASS != 0 || base >= KEY_SPACE) {
+            throw std::invalid_argument("Pass base must be a multiple of 64 inside the key space");
+        }
+
+        uint64_t key[64];
+        for (int k = 0; k < 64; k++) {
+            int bit = indexBit(k);
+            key[k] = bit < 0 ? 0 : bit < 6 ? LANE_BITS[bit] : broadcast(base, bit);
+        }
+
+        // Bit i of each half (0 = most significant) as a lane mask; every lane shares the plaintext
+        uint64_t halves[2][32];
+        uint64_t* L = halves[0];
+        uint64_t* R = halves[1];
+        for (int i = 0; i < 32; i++) {
+            L[i] = broadcast(m_start, 63 - i);
+            R[i] = broadcast(m_start, 31 - i);
+        }
+
+        for (int r = 0; r < 16; r++) {
+            feistel(r, key, R, L, std::make_integer_sequence<int, 8>{});
+            std::swap(L, R);
+        }
+
+        // FP's input is R16 || L16; compare lanes against IP(ciphertext), stopping once none is left
+        uint64_t match = ~uint64_t{0};
+        for (int i = 0; i < 32 && match; i++) {
+            match &= ~(R[i] ^ broadcast(m_target, 63 - i));
+            match &= ~(L[i] ^ broadcast(m_target, 31 - i));
+        }
+        return match;
+    }
+
+    std::optional<uint64_t> DESKeySearch::search(uint64_t first, uint64_t count, unsigned threads) const {
+        if (first >= KEY_SPACE || count > KEY_SPACE - first) {
+            throw std::invalid_argument("Key range exceeds the 56-bit key space");
+        }
+        if (count == 0) return std::nullopt;
+
+        const uint64_t last = first + count - 1;
+        const uint64_t firstPass = first / KEYS_PER_PASS;
+        const uint64_t passes = last / KEYS_PER_PASS - firstPass + 1;
+        const uint64_t chunks = (passes + CHUNK_PASSES - 1) / CHUNK_PASSES;
+
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<uint64_t>(threads, chunks));
+
+        // Chunks are handed out in index order, so once a match is known only lower chunks still matter
+        std::atomic<uint64_t> nextChunk{0};
+        std::atomic<uint64_t> best{KEY_SPACE};
+
+        auto worker = [&] {
+            for (uint64_t chunk; (chunk = nextChunk.fetch_add(1)) < chunks;) {
+                uint64_t pass = firstPass + chunk * CHUNK_PASSES;
+                uint64_t end = std::min(pass + CHUNK_PASSES, firstPass + passes);
+                if (pass * KEYS_PER_PASS >= best.load()) return;
+
+                for (; pass < end; pass++) {
+                    uint64_t base = pass * KEYS_PER_PASS;
+                    uint64_t lanes = matchLanes(base);
+
+                    // Drop lanes outside [first, last] in the partial first and last passes
+                    if (base < first) lanes &= ~uint64_t{0} << (first - base);
+                    if (last - base < KEYS_PER_PASS - 1) lanes &= ~(~uint64_t{0} << (last - base + 1));
+
+                    if (lanes) {
+                        uint64_t found = base + std::countr_zero(lanes);
+                        uint64_t current = best.load();
+                        while (found < current && !best.compare_exchange_weak(current, found)) {}
+                        break;
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; t++) workers.emplace_back(worker);
+        worker();
+        for (auto& w : workers) w.join();
+
+        uint64_t found = best.load();
+        if (found == KEY_SPACE) return std::nullopt;
+        return found;
+    }
+
+    Bytes DESKeySearch::keyFromIndex(uint64_t index) {
+        if (index >= KEY_SPACE) throw std::invalid_argument("Key index exceeds 56 bits");
+
+        Bytes key(8);
+        for (int b = 0; b < 8; b++) {
+            uint8_t byte = static_cast<uint8_t>(((index >> (7 * (7 - b))) & 0x7F) << 1);
+            key[b] = byte | static_cast<uint8_t>((std::popcount(byte) & 1) ^ 1);
+        }
+        return key;
+    }
+
+    uint64_t DESKeySearch::indexFromKey(const Bytes& key) {
+        if (key.size() != 8) throw std::invalid_argument("DES key must be 8 bytes (64 bits)");
+
+        uint64_t index = 0;
+        for (uint8_t byte : key) index = (index << 7) | (byte >> 1);
+        return index;
+    }
+
+} // namespace crypto::modern::block::symmetric
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+
+#include "crypto/core/types.h"
+
+namespace crypto::modern::block::symmetric {
+
+    using crypto::core::Bytes;
+
+    // Known-plaintext DES key search with a bitsliced kernel: each pass evaluates 64 keys at once,
+    // one per bit of a uint64_t, with the S-boxes computed from their algebraic normal form.
+    //
+    // Keys are addressed by a 56-bit index holding the seven key bits of each byte, most
+    // significant byte first; parity bits are ignored (keyFromIndex sets them to odd parity).
+    class DESKeySearch {
+    public:
+        static constexpr size_t KEYS_PER_PASS = 64;
+        static constexpr uint64_t KEY_SPACE = uint64_t{1} << 56;
+
+        DESKeySearch(const Bytes& plaintext, const Bytes& ciphertext);
+
+        // Lowest index in [first, first + count) whose key maps plaintext to ciphertext.
+        // threads == 0 means one per hardware thread.
+        std::optional<uint64_t> search(uint64_t first, uint64_t count, unsigned threads = 0) const;
+
+        // One kernel pass over indices base .. base + 63 (base a multiple of 64):
+        // bit j is set if base + j is a matching key
+        uint64_t matchLanes(uint64_t base) const;
+
+        static Bytes keyFromIndex(uint64_t index);
+        static uint64_t indexFromKey(const Bytes& key);
+
+    private:
+        // Passes handed to a worker at a time
+        static constexpr uint64_t CHUNK_PASSES = 256;
+
+        // IP(plaintext) and IP(ciphertext): the cipher's state before round 1 and before FP
+        uint64_t m_start;
+        uint64_t m_target;
+    };
+
+} // namespace crypto::modern::block::symmetric
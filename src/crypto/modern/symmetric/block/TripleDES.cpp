@@ -0,0 +1,71 @@
+#include <stdexcept>
+#include <algorithm>
+
+#include "crypto/modern/symmetric/block/TripleDES.h"
+
+namespace crypto::modern::block::symmetric {
+
+    TripleDES::TripleDES(size_t keySizeBytes)
+        : m_k1(DES::Engine::SPBox), m_k2(DES::Engine::SPBox), m_k3(DES::Engine::SPBox), m_keySizeBytes(keySizeBytes) {
+        if (keySizeBytes != 16 && keySizeBytes != 24) {
+            throw std::invalid_argument("3DES key must be 16 (2-key) or 24 (3-key) bytes");
+        }
+    }
+
+    void TripleDES::setKey(const Bytes& key) {
+        if (key.size() != m_keySizeBytes) {
+            throw std::invalid_argument("3DES key size mismatch");
+        }
+
+        m_k1.setKey(Bytes(key.begin(), key.begin() + 8));
+        m_k2.setKey(Bytes(key.begin() + 8, key.begin() + 16));
+        m_k3.setKey(m_keySizeBytes == 24 ? Bytes(key.begin() + 16, key.end()) : Bytes(key.begin(), key.begin() + 8));
+    }
+
+    void TripleDES::crypt(const uint8_t* in, uint8_t* out, size_t nblocks, bool decrypt) const {
+        // Decryption is D_K1(E_K2(D_K3(C)))
+        const DES& first = decrypt ? m_k3 : m_k1;
+        const DES& last = decrypt ? m_k1 : m_k3;
+
+        uint32_t L[PARALLEL_BLOCKS], R[PARALLEL_BLOCKS];
+        for (size_t i = 0; i < nblocks; i += PARALLEL_BLOCKS) {
+            size_t n = std::min(PARALLEL_BLOCKS, nblocks - i);
+            DES::loadHalves(in + 8 * i, L, R, n);
+            first.spRounds(L, R, n, decrypt);
+            m_k2.spRounds(L, R, n, !decrypt);
+            last.spRounds(L, R, n, decrypt);
+            DES::storeHalves(L, R, out + 8 * i, n);
+        }
+    }
+
+    void TripleDES::encryptBlock(const Bytes& plaintext, Bytes& ciphertext) const {
+        if (plaintext.size() != 8) {
+            throw std::invalid_argument("DES block must be 8 bytes");
+        }
+        ciphertext.resize(8);
+        crypt(plaintext.data(), ciphertext.data(), 1, false);
+    }
+
+    void TripleDES::decryptBlock(const Bytes& ciphertext, Bytes& plaintext) const {
+        if (ciphertext.size() != 8) {
+            throw std::invalid_argument("DES block must be 8 bytes");
+        }
+        plaintext.resize(8);
+        crypt(ciphertext.data(), plaintext.data(), 1, true);
+    }
+
+    void TripleDES::encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 8 || out.size() < nblocks * 8) {
+            throw std::invalid_argument("DES input and output must hold nblocks * 8 bytes");
+        }
+        crypt(in.data(), out.data(), nblocks, false);
+    }
+
+    void TripleDES::decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const {
+        if (in.size() < nblocks * 8 || out.size() < nblocks * 8) {
+            throw std::invalid_argument("DES input and output must hold nblocks * 8 bytes");
+        }
+        crypt(in.data(), out.data(), nblocks, true);
+    }
+
+} // namespace crypto::modern::block::symmetric
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+#include "crypto/modern/symmetric/block/DES.h"
+
+namespace crypto::modern::block::symmetric {
+
+    using crypto::core::Bytes;
+
+    // 3DES-EDE (SP 800-67): C = E_K3(D_K2(E_K1(P))). A 24-byte key is K1 || K2 || K3,
+    // a 16-byte key is the 2-key variant K1 || K2 with K3 = K1.
+    // Runs the three passes on the SP-box DES engine with a single IP/FP around them.
+    class TripleDES final : public crypto::core::symmetric::IBlockCipher {
+    public:
+        static constexpr size_t PARALLEL_BLOCKS = DES::PARALLEL_BLOCKS;
+
+        explicit TripleDES(size_t keySizeBytes = 24);
+        ~TripleDES() override = default;
+
+        void setKey(const Bytes& key) override;
+        void encryptBlock(const Bytes& in, Bytes& out) const override;
+        void decryptBlock(const Bytes& in, Bytes& out) const override;
+
+        void encryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+        void decryptBlocks(std::span<const uint8_t> in, std::span<uint8_t> out, size_t nblocks) const override;
+
+        size_t blockSize() const noexcept override { return 8; }
+        size_t keySize() const noexcept override { return m_keySizeBytes; }
+
+    private:
+        DES m_k1, m_k2, m_k3;
+        size_t m_keySizeBytes;
+
+        void crypt(const uint8_t* in, uint8_t* out, size_t nblocks, bool decrypt) const;
+    };
+
+} // namespace crypto::modern::block::symmetric
@@ -0,0 +1,38 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace crypto::modern::mode::symmetric {
+
+    // Number of worker threads for a job of nblocks; each thread gets at least minBlocks.
+    // threads == 0 means one per hardware thread.
+    inline unsigned threadsFor(size_t nblocks, size_t minBlocks, unsigned threads) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        size_t useful = minBlocks ? nblocks / minBlocks : nblocks;
+        if (useful < threads) threads = static_cast<unsigned>(std::max<size_t>(1, useful));
+        return threads;
+    }
+
+    // Splits [0, nblocks) into `threads` contiguous ranges and runs fn(begin, end) on each.
+    // The calling thread takes the first range; fn must not throw.
+    template <typename Fn>
+    void forEachBlockRange(size_t nblocks, unsigned threads, Fn&& fn) {
+        if (threads <= 1) {
+            fn(size_t{0}, nblocks);
+            return;
+        }
+
+        size_t per = (nblocks + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (size_t begin = per; begin < nblocks; begin += per) {
+            workers.emplace_back([&fn, begin, end = std::min(nblocks, begin + per)] { fn(begin, end); });
+        }
+        fn(size_t{0}, std::min(nblocks, per));
+
+        for (auto& worker : workers) worker.join();
+    }
+
+} // namespace crypto::modern::mode::symmetric
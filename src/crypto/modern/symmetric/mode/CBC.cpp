@@ -0,0 +1,89 @@
+#include <stdexcept>
+#include <cstring>
+
+#include "crypto/modern/symmetric/mode/CBC.h"
+#include "crypto/modern/symmetric/mode/BlockRanges.h"
+
+namespace crypto::modern::mode::symmetric {
+
+    CBC::CBC(std::shared_ptr<const IBlockCipher> cipher): m_cipher(std::move(cipher)) {
+        if (!m_cipher) throw std::invalid_argument("CBC requires a block cipher");
+    }
+
+    void CBC::setIV(const Bytes& iv) {
+        if (iv.size() != m_cipher->blockSize()) {
+            throw std::invalid_argument("IV size must match the cipher block size");
+        }
+        m_iv = iv;
+    }
+
+    void CBC::setThreads(unsigned threads) noexcept {
+        m_threads = threads;
+    }
+
+    Bytes CBC::encrypt(const Bytes& plaintext) {
+        if (m_iv.empty()) throw std::runtime_error("IV not set");
+
+        const size_t bs = m_cipher->blockSize();
+        const size_t padding = bs - plaintext.size() % bs;
+
+        Bytes out(plaintext.size() + padding);
+        std::memcpy(out.data(), plaintext.data(), plaintext.size());
+        std::memset(out.data() + plaintext.size(), static_cast<int>(padding), padding);
+
+        const uint8_t* prev = m_iv.data();
+        for (size_t off = 0; off < out.size(); off += bs) {
+            uint8_t* block = out.data() + off;
+            for (size_t i = 0; i < bs; ++i) block[i] ^= prev[i];
+            m_cipher->encryptBlocks({block, bs}, {block, bs}, 1);
+            prev = block;
+        }
+        return out;
+    }
+
+    Bytes CBC::decrypt(const Bytes& ciphertext) {
+        if (m_iv.empty()) throw std::runtime_error("IV not set");
+
+        const size_t bs = m_cipher->blockSize();
+        if (ciphertext.empty() || ciphertext.size() % bs != 0) {
+            throw std::invalid_argument("Ciphertext must be a non-empty multiple of the block size");
+        }
+
+        // P[i] = D(C[i]) ^ C[i-1] only depends on ciphertext, so ranges are independent
+        const size_t nblocks = ciphertext.size() / bs;
+        Bytes out(ciphertext.size());
+        unsigned threads = threadsFor(nblocks, PARALLEL_MIN_BYTES / bs, m_threads);
+
+        forEachBlockRange(nblocks, threads, [&](size_t begin, size_t end) {
+            const uint8_t* in = ciphertext.data() + begin * bs;
+            uint8_t* dst = out.data() + begin * bs;
+            m_cipher->decryptBlocks({in, (end - begin) * bs}, {dst, (end - begin) * bs}, end - begin);
+
+            // First block of the range chains from the IV or the preceding ciphertext block,
+            // the rest from the ciphertext shifted by one block
+            size_t first = begin;
+            if (begin == 0) {
+                for (size_t i = 0; i < bs; ++i) dst[i] ^= m_iv[i];
+                first = 1;
+            }
+            if (first < end) {
+                uint8_t* x = out.data() + first * bs;
+                const uint8_t* prev = ciphertext.data() + (first - 1) * bs;
+                const size_t bytes = (end - first) * bs;
+                for (size_t i = 0; i < bytes; ++i) x[i] ^= prev[i];
+            }
+        });
+
+        // PKCS#7: 1..bs bytes, all equal to the pad length. Every byte is checked either way.
+        uint8_t padding = out.back();
+        uint8_t bad = (padding == 0 || padding > bs) ? 1 : 0;
+        for (size_t i = 0; i < bs; ++i) {
+            bad |= static_cast<uint8_t>((i < padding) & (out[out.size() - 1 - i] != padding));
+        }
+        if (bad) throw std::runtime_error("Invalid padding");
+
+        out.resize(out.size() - padding);
+        return out;
+    }
+
+} // namespace crypto::modern::mode::symmetric
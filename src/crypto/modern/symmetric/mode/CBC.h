@@ -0,0 +1,36 @@
+#pragma once
+#include <memory>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+#include "crypto/core/symmetric/ICipherMode.h"
+
+namespace crypto::modern::mode::symmetric {
+
+    using crypto::core::Bytes;
+    using crypto::core::symmetric::IBlockCipher;
+
+    // CBC with PKCS#7 padding over any keyed block cipher. Every call starts from the IV.
+    // Encryption is serial by nature; decryption runs the block cipher over the whole buffer
+    // and splits large inputs across threads.
+    class CBC final : public crypto::core::symmetric::ICipherMode {
+    public:
+        // Below this many bytes per thread, decryption stays on the calling thread
+        static constexpr size_t PARALLEL_MIN_BYTES = 256 * 1024;
+
+        explicit CBC(std::shared_ptr<const IBlockCipher> cipher);
+
+        void setIV(const Bytes& iv) override;
+
+        Bytes encrypt(const Bytes& plaintext) override;
+        Bytes decrypt(const Bytes& ciphertext) override;
+
+        // 0 = one per hardware thread, 1 = never spawn threads
+        void setThreads(unsigned threads) noexcept;
+
+    private:
+        std::shared_ptr<const IBlockCipher> m_cipher;
+        Bytes m_iv;
+        unsigned m_threads = 0;
+    };
+
+} // namespace crypto::modern::mode::symmetric
@@ -0,0 +1,80 @@
+#include <stdexcept>
+#include <cstring>
+
+#include "crypto/modern/symmetric/mode/CTR.h"
+#include "crypto/modern/symmetric/mode/BlockRanges.h"
+
+namespace {
+    // counter += n, big-endian over the whole block
+    void addCounter(uint8_t* counter, size_t size, uint64_t n) {
+        for (size_t i = size; i-- > 0 && n;) {
+            uint64_t sum = counter[i] + (n & 0xFF);
+            counter[i] = static_cast<uint8_t>(sum);
+            n = (n >> 8) + (sum >> 8);
+        }
+    }
+}
+
+namespace crypto::modern::mode::symmetric {
+
+    CTR::CTR(std::shared_ptr<const IBlockCipher> cipher): m_cipher(std::move(cipher)) {
+        if (!m_cipher) throw std::invalid_argument("CTR requires a block cipher");
+        if (m_cipher->blockSize() > 16) throw std::invalid_argument("CTR supports block sizes up to 16 bytes");
+    }
+
+    void CTR::setIV(const Bytes& iv) {
+        if (iv.size() != m_cipher->blockSize()) {
+            throw std::invalid_argument("IV size must match the cipher block size");
+        }
+        m_iv = iv;
+    }
+
+    void CTR::setThreads(unsigned threads) noexcept {
+        m_threads = threads;
+    }
+
+    Bytes CTR::encrypt(const Bytes& plaintext) {
+        return apply(plaintext);
+    }
+
+    Bytes CTR::decrypt(const Bytes& ciphertext) {
+        return apply(ciphertext);
+    }
+
+    Bytes CTR::apply(const Bytes& in) const {
+        if (m_iv.empty()) throw std::runtime_error("IV not set");
+
+        const size_t bs = m_cipher->blockSize();
+        const size_t nblocks = (in.size() + bs - 1) / bs;
+        Bytes out(in.size());
+        unsigned threads = threadsFor(nblocks, PARALLEL_MIN_BYTES / bs, m_threads);
+
+        // Each range starts from IV + begin, so threads never share counter state
+        forEachBlockRange(nblocks, threads, [&](size_t begin, size_t end) {
+            uint8_t counters[BATCH_BLOCKS * 16];
+            uint8_t keystream[BATCH_BLOCKS * 16];
+            uint8_t counter[16];
+
+            std::memcpy(counter, m_iv.data(), bs);
+            addCounter(counter, bs, begin);
+
+            for (size_t b = begin; b < end; b += BATCH_BLOCKS) {
+                size_t count = std::min(BATCH_BLOCKS, end - b);
+                for (size_t i = 0; i < count; ++i) {
+                    std::memcpy(counters + i * bs, counter, bs);
+                    addCounter(counter, bs, 1);
+                }
+                m_cipher->encryptBlocks({counters, count * bs}, {keystream, count * bs}, count);
+
+                size_t offset = b * bs;
+                size_t bytes = std::min(count * bs, in.size() - offset);
+                const uint8_t* src = in.data() + offset;
+                uint8_t* dst = out.data() + offset;
+                for (size_t i = 0; i < bytes; ++i) dst[i] = src[i] ^ keystream[i];
+            }
+        });
+
+        return out;
+    }
+
+} // namespace crypto::modern::mode::symmetric
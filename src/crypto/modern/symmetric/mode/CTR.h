@@ -0,0 +1,40 @@
+#pragma once
+#include <memory>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+#include "crypto/core/symmetric/ICipherMode.h"
+
+namespace crypto::modern::mode::symmetric {
+
+    using crypto::core::Bytes;
+    using crypto::core::symmetric::IBlockCipher;
+
+    // CTR over any keyed block cipher. The IV is the initial counter block and is incremented
+    // as one big-endian integer (OpenSSL's CTR convention). Every call starts from the IV;
+    // encrypt and decrypt are the same operation.
+    class CTR final : public crypto::core::symmetric::ICipherMode {
+    public:
+        // Counter blocks handed to encryptBlocks per call
+        static constexpr size_t BATCH_BLOCKS = 32;
+        // Below this many bytes per thread, the keystream is generated on the calling thread
+        static constexpr size_t PARALLEL_MIN_BYTES = 256 * 1024;
+
+        explicit CTR(std::shared_ptr<const IBlockCipher> cipher);
+
+        void setIV(const Bytes& iv) override;
+
+        Bytes encrypt(const Bytes& plaintext) override;
+        Bytes decrypt(const Bytes& ciphertext) override;
+
+        // 0 = one per hardware thread, 1 = never spawn threads
+        void setThreads(unsigned threads) noexcept;
+
+    private:
+        std::shared_ptr<const IBlockCipher> m_cipher;
+        Bytes m_iv;
+        unsigned m_threads = 0;
+
+        Bytes apply(const Bytes& in) const;
+    };
+
+} // namespace crypto::modern::mode::symmetric
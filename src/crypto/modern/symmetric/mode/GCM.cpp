@@ -0,0 +1,331 @@
+#include <stdexcept>
+#include <cstring>
+
+#include "crypto/modern/symmetric/mode/GCM.h"
+#include "crypto/core/utils.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CRYPTO_HAS_PCLMUL 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define PCLMUL_TARGET
+    #else
+        #include <cpuid.h>
+        #define PCLMUL_TARGET __attribute__((target("pclmul,ssse3,sse2")))
+    #endif
+#else
+    #define CRYPTO_HAS_PCLMUL 0
+#endif
+
+
+namespace {
+    using crypto::core::utils::secure_zeroize;
+
+    inline uint64_t load_be64(const uint8_t* p) {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    inline void store_be64(uint64_t v, uint8_t* p) {
+        for (int i = 7; i >= 0; --i) {
+            p[i] = static_cast<uint8_t>(v);
+            v >>= 8;
+        }
+    }
+
+    // Increments the low 32 bits of a counter block (big-endian), as GCM's inc32
+    inline void inc32(uint8_t* counter) {
+        for (int i = 15; i >= 12; --i) {
+            if (++counter[i] != 0) break;
+        }
+    }
+
+#if CRYPTO_HAS_PCLMUL
+    bool cpuHasPclmul() {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuid(regs, 1);
+        return (regs[2] & (1 << 1)) && (regs[2] & (1 << 9));
+    #else
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+        return (ecx & bit_PCLMUL) && (ecx & bit_SSSE3);
+    #endif
+    }
+
+    // Carry-less 128x128 multiply and reduction in GCM's bit-reflected field (Intel's gfmul)
+    PCLMUL_TARGET inline __m128i gfmul(__m128i a, __m128i b) {
+        __m128i t3 = _mm_clmulepi64_si128(a, b, 0x00);
+        __m128i t4 = _mm_clmulepi64_si128(a, b, 0x10);
+        __m128i t5 = _mm_clmulepi64_si128(a, b, 0x01);
+        __m128i t6 = _mm_clmulepi64_si128(a, b, 0x11);
+
+        t4 = _mm_xor_si128(t4, t5);
+        t5 = _mm_slli_si128(t4, 8);
+        t4 = _mm_srli_si128(t4, 8);
+        t3 = _mm_xor_si128(t3, t5);
+        t6 = _mm_xor_si128(t6, t4);
+
+        // Shift the 256-bit product left by one (the operands are bit-reflected)
+        __m128i t7 = _mm_srli_epi32(t3, 31);
+        __m128i t8 = _mm_srli_epi32(t6, 31);
+        t3 = _mm_slli_epi32(t3, 1);
+        t6 = _mm_slli_epi32(t6, 1);
+        __m128i t9 = _mm_srli_si128(t7, 12);
+        t8 = _mm_slli_si128(t8, 4);
+        t7 = _mm_slli_si128(t7, 4);
+        t3 = _mm_or_si128(t3, t7);
+        t6 = _mm_or_si128(t6, t8);
+        t6 = _mm_or_si128(t6, t9);
+
+        // Reduce modulo x^128 + x^7 + x^2 + x + 1
+        t7 = _mm_slli_epi32(t3, 31);
+        t8 = _mm_slli_epi32(t3, 30);
+        t9 = _mm_slli_epi32(t3, 25);
+        t7 = _mm_xor_si128(t7, t8);
+        t7 = _mm_xor_si128(t7, t9);
+        t8 = _mm_srli_si128(t7, 4);
+        t7 = _mm_slli_si128(t7, 12);
+        t3 = _mm_xor_si128(t3, t7);
+
+        __m128i t2 = _mm_srli_epi32(t3, 1);
+        t4 = _mm_srli_epi32(t3, 2);
+        t5 = _mm_srli_epi32(t3, 7);
+        t2 = _mm_xor_si128(t2, t4);
+        t2 = _mm_xor_si128(t2, t5);
+        t2 = _mm_xor_si128(t2, t8);
+        t3 = _mm_xor_si128(t3, t2);
+        return _mm_xor_si128(t6, t3);
+    }
+
+    PCLMUL_TARGET void ghashClmul(uint8_t* x, const uint8_t* h, const uint8_t* data, size_t nblocks) {
+        const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m128i hv = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(h)), bswap);
+        __m128i xv = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)), bswap);
+
+        for (size_t i = 0; i < nblocks; ++i) {
+            __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i), bswap);
+            xv = gfmul(_mm_xor_si128(xv, block), hv);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(x), _mm_shuffle_epi8(xv, bswap));
+    }
+#endif
+
+    const bool HAS_PCLMUL =
+#if CRYPTO_HAS_PCLMUL
+        cpuHasPclmul();
+#else
+        false;
+#endif
+
+    // Reduction of the 4 bits shifted out per step (Shoup's method)
+    constexpr uint64_t LAST4[16] = {
+        0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+        0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+    };
+
+    // GHASH accumulator over H. Segments (AAD, then ciphertext) are zero-padded to 16 bytes.
+    // clmul = false forces the table path even on PCLMULQDQ hardware.
+    class GHash {
+    public:
+        GHash(const uint8_t* h, bool clmul) : m_clmul(clmul && HAS_PCLMUL) {
+            std::memcpy(m_h, h, 16);
+            if (m_clmul) return;
+
+            // 4-bit tables: m_hl/m_hh[i] = i * H, bits taken in GCM's reflected order
+            uint64_t vh = load_be64(h), vl = load_be64(h + 8);
+            m_hh[8] = vh; m_hl[8] = vl;
+            m_hh[0] = 0;  m_hl[0] = 0;
+            for (int i = 4; i > 0; i >>= 1) {
+                uint64_t t = (vl & 1) * 0xe1000000ull;
+                vl = (vh << 63) | (vl >> 1);
+                vh = (vh >> 1) ^ (t << 32);
+                m_hh[i] = vh; m_hl[i] = vl;
+            }
+            for (int i = 2; i <= 8; i *= 2) {
+                for (int j = 1; j < i; ++j) {
+                    m_hh[i + j] = m_hh[i] ^ m_hh[j];
+                    m_hl[i + j] = m_hl[i] ^ m_hl[j];
+                }
+            }
+        }
+
+        ~GHash() {
+            secure_zeroize(m_h, sizeof(m_h));
+            secure_zeroize(m_hh, sizeof(m_hh));
+            secure_zeroize(m_hl, sizeof(m_hl));
+        }
+
+        void update(const uint8_t* data, size_t size) {
+            size_t full = size / 16;
+            blocks(data, full);
+
+            if (size_t rest = size % 16) {
+                uint8_t last[16] = {};
+                std::memcpy(last, data + 16 * full, rest);
+                blocks(last, 1);
+            }
+        }
+
+        void finish(uint64_t aadBytes, uint64_t dataBytes, uint8_t* out) {
+            uint8_t lengths[16];
+            store_be64(aadBytes * 8, lengths);
+            store_be64(dataBytes * 8, lengths + 8);
+            blocks(lengths, 1);
+            std::memcpy(out, m_x, 16);
+        }
+
+    private:
+        bool m_clmul;
+        uint8_t m_h[16];
+        uint8_t m_x[16] = {};
+        uint64_t m_hh[16] = {};
+        uint64_t m_hl[16] = {};
+
+        void blocks(const uint8_t* data, size_t nblocks) {
+#if CRYPTO_HAS_PCLMUL
+            if (m_clmul) return ghashClmul(m_x, m_h, data, nblocks);
+#endif
+            for (size_t b = 0; b < nblocks; ++b) {
+                for (int i = 0; i < 16; ++i) m_x[i] ^= data[16 * b + i];
+                multiplyH();
+            }
+        }
+
+        // m_x = m_x * H, one nibble at a time from the last byte
+        void multiplyH() {
+            uint8_t lo = m_x[15] & 0xf;
+            uint64_t zh = m_hh[lo], zl = m_hl[lo];
+
+            for (int i = 15; i >= 0; --i) {
+                lo = m_x[i] & 0xf;
+                uint8_t hi = (m_x[i] >> 4) & 0xf;
+
+                if (i != 15) {
+                    uint8_t rem = zl & 0xf;
+                    zl = (zh << 60) | (zl >> 4);
+                    zh = (zh >> 4) ^ (LAST4[rem] << 48);
+                    zh ^= m_hh[lo];
+                    zl ^= m_hl[lo];
+                }
+
+                uint8_t rem = zl & 0xf;
+                zl = (zh << 60) | (zl >> 4);
+                zh = (zh >> 4) ^ (LAST4[rem] << 48);
+                zh ^= m_hh[hi];
+                zl ^= m_hl[hi];
+            }
+
+            store_be64(zh, m_x);
+            store_be64(zl, m_x + 8);
+        }
+    };
+
+    // Maximum plaintext length for one IV (SP 800-38D: 2^39 - 256 bits)
+    constexpr uint64_t MAX_DATA_BYTES = (1ull << 36) - 32;
+}
+
+
+namespace crypto::modern::mode::symmetric {
+
+    GCM::GCM(std::shared_ptr<const IBlockCipher> cipher, GHashEngine ghash): m_cipher(std::move(cipher)), m_ghash(ghash) {
+        if (!m_cipher) throw std::invalid_argument("GCM requires a block cipher");
+        if (m_cipher->blockSize() != 16) throw std::invalid_argument("GCM requires a 128-bit block cipher");
+    }
+
+    bool GCM::usesCarrylessMultiply() noexcept {
+        return HAS_PCLMUL;
+    }
+
+    void GCM::setIV(const Bytes& iv) {
+        if (iv.empty()) throw std::invalid_argument("GCM IV must not be empty");
+        m_iv = iv;
+        m_ivUsed = false;
+    }
+
+    void GCM::setAAD(const Bytes& aad) {
+        m_aad = aad;
+    }
+
+    Bytes GCM::encrypt(const Bytes& plaintext) {
+        if (m_ivUsed) throw std::runtime_error("GCM IV already used for encryption; set a new one");
+
+        Bytes out(plaintext.size() + TAG_SIZE);
+        crypt(plaintext.data(), out.data(), plaintext.size(), true, out.data() + plaintext.size());
+        m_ivUsed = true;
+        return out;
+    }
+
+    Bytes GCM::decrypt(const Bytes& ciphertextAndTag) {
+        if (ciphertextAndTag.size() < TAG_SIZE) throw std::invalid_argument("GCM input is shorter than the tag");
+
+        size_t size = ciphertextAndTag.size() - TAG_SIZE;
+        Bytes out(size);
+        uint8_t tag[16];
+        crypt(ciphertextAndTag.data(), out.data(), size, false, tag);
+
+        uint8_t diff = 0;
+        for (size_t i = 0; i < TAG_SIZE; ++i) diff |= tag[i] ^ ciphertextAndTag[size + i];
+        if (diff != 0) {
+            secure_zeroize(out.data(), out.size());
+            throw std::runtime_error("GCM authentication failed");
+        }
+        return out;
+    }
+
+    void GCM::crypt(const uint8_t* in, uint8_t* out, size_t size, bool encrypting, uint8_t tag[16]) const {
+        if (m_iv.empty()) throw std::runtime_error("IV not set");
+        if (size > MAX_DATA_BYTES) throw std::invalid_argument("GCM input too long for one IV");
+
+        // H = E(0^128); recomputed per call so a re-keyed cipher is picked up
+        uint8_t h[16] = {};
+        m_cipher->encryptBlocks({h, 16}, {h, 16}, 1);
+        const bool clmul = m_ghash == GHashEngine::Auto;
+        GHash ghash(h, clmul);
+
+        // J0 = IV || 0^31 || 1 for 96-bit IVs, GHASH(IV) otherwise
+        uint8_t j0[16] = {};
+        if (m_iv.size() == 12) {
+            std::memcpy(j0, m_iv.data(), 12);
+            j0[15] = 1;
+        } else {
+            GHash ivHash(h, clmul);
+            ivHash.update(m_iv.data(), m_iv.size());
+            ivHash.finish(0, m_iv.size(), j0);
+        }
+        secure_zeroize(h, sizeof(h));
+
+        ghash.update(m_aad.data(), m_aad.size());
+
+        uint8_t counter[16];
+        std::memcpy(counter, j0, 16);
+        inc32(counter);
+
+        uint8_t counters[BATCH_BLOCKS * 16];
+        uint8_t keystream[BATCH_BLOCKS * 16];
+        for (size_t offset = 0; offset < size; offset += BATCH_BLOCKS * 16) {
+            size_t bytes = std::min(BATCH_BLOCKS * 16, size - offset);
+            size_t count = (bytes + 15) / 16;
+
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(counters + 16 * i, counter, 16);
+                inc32(counter);
+            }
+            m_cipher->encryptBlocks({counters, 16 * count}, {keystream, 16 * count}, count);
+
+            if (!encrypting) ghash.update(in + offset, bytes);
+            for (size_t i = 0; i < bytes; ++i) out[offset + i] = in[offset + i] ^ keystream[i];
+            if (encrypting) ghash.update(out + offset, bytes);
+        }
+        secure_zeroize(keystream, sizeof(keystream));
+
+        // T = E(J0) ^ GHASH(A, C)
+        ghash.finish(m_aad.size(), size, tag);
+        m_cipher->encryptBlocks({j0, 16}, {j0, 16}, 1);
+        for (size_t i = 0; i < 16; ++i) tag[i] ^= j0[i];
+    }
+
+} // namespace crypto::modern::mode::symmetric
@@ -0,0 +1,55 @@
+#pragma once
+#include <array>
+#include <memory>
+
+#include "crypto/core/symmetric/IBlockCipher.h"
+#include "crypto/core/symmetric/ICipherMode.h"
+
+namespace crypto::modern::mode::symmetric {
+
+    using crypto::core::Bytes;
+    using crypto::core::symmetric::IBlockCipher;
+
+    // GCM (NIST SP 800-38D) over a keyed 128-bit block cipher. encrypt() returns
+    // ciphertext || 16-byte tag and decrypt() expects the same layout, throwing if the tag
+    // does not verify. GHASH uses PCLMULQDQ when the CPU has it, otherwise 4-bit tables.
+    class GCM final : public crypto::core::symmetric::ICipherMode {
+    public:
+        static constexpr size_t TAG_SIZE = 16;
+        // Counter blocks handed to encryptBlocks per call
+        static constexpr size_t BATCH_BLOCKS = 32;
+
+        // Auto:  PCLMULQDQ when the CPU has it, otherwise the 4-bit tables.
+        // Table: always the 4-bit tables (portable path, also for cross-checking).
+        enum class GHashEngine { Auto, Table };
+
+        explicit GCM(std::shared_ptr<const IBlockCipher> cipher, GHashEngine ghash = GHashEngine::Auto);
+
+        // 12-byte IVs are used directly; any other non-empty length is run through GHASH.
+        // An IV seals one message: encrypt() throws until setIV() is called again, since a reused
+        // nonce exposes the XOR of the plaintexts and the GHASH key. decrypt() may reuse it.
+        void setIV(const Bytes& iv) override;
+
+        // Additional authenticated data for the following encrypt/decrypt calls
+        void setAAD(const Bytes& aad);
+
+        Bytes encrypt(const Bytes& plaintext) override;
+        Bytes decrypt(const Bytes& ciphertextAndTag) override;
+
+        // Whether GHashEngine::Auto picks PCLMULQDQ on this CPU
+        static bool usesCarrylessMultiply() noexcept;
+
+        GHashEngine ghashEngine() const noexcept { return m_ghash; }
+
+    private:
+        std::shared_ptr<const IBlockCipher> m_cipher;
+        GHashEngine m_ghash;
+        Bytes m_iv;
+        bool m_ivUsed = false;  // m_iv has already sealed a message
+        Bytes m_aad;
+
+        // Keystream for [in, in + size) starting at inc32(J0); returns the tag over aad || out
+        void crypt(const uint8_t* in, uint8_t* out, size_t size, bool encrypting, uint8_t tag[16]) const;
+    };
+
+} // namespace crypto::modern::mode::symmetric
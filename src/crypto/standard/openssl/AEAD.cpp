@@ -0,0 +1,218 @@
+#include <stdexcept>
+#include <climits>
+#include <algorithm>
+
+#include <openssl/evp.h>
+
+#include "crypto/standard/openssl/AEAD.h"
+
+
+namespace crypto::standard::openssl {
+
+    // EVP lengths are int; larger buffers go through in 1 GiB slices
+    static constexpr size_t MAX_UPDATE = size_t{1} << 30;
+
+    static void update_all(EVP_CIPHER_CTX* ctx, bool encrypt, uint8_t* out, const uint8_t* in, size_t size) {
+        size_t done = 0;
+        do {
+            int chunk = static_cast<int>(std::min(MAX_UPDATE, size - done));
+            int len = 0;
+            int ok = encrypt ? EVP_EncryptUpdate(ctx, out ? out + done : nullptr, &len, in + done, chunk)
+                             : EVP_DecryptUpdate(ctx, out ? out + done : nullptr, &len, in + done, chunk);
+            if (ok != 1) throw std::runtime_error(encrypt ? "EncryptUpdate failed" : "DecryptUpdate failed");
+            done += static_cast<size_t>(chunk);
+        } while (done < size);
+    }
+
+    static void rearm(EVP_CIPHER_CTX* ctx, const Bytes& nonce, bool encrypt) {
+        int ok = encrypt ? EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, nonce.data())
+                         : EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, nonce.data());
+        if (ok != 1) throw std::runtime_error(encrypt ? "EncryptInit failed" : "DecryptInit failed");
+    }
+
+    AEAD::AEAD(const evp_cipher_st* cipher, size_t keySize): m_cipher(cipher), m_keySize(keySize) {
+        if (!m_cipher) throw std::runtime_error("AEAD cipher unavailable in this OpenSSL build");
+    }
+
+    AEAD::~AEAD() {
+        OPENSSL_cleanse(m_key.data(), m_key.size());
+        OPENSSL_cleanse(m_nonce.data(), m_nonce.size());
+    }
+
+    void AEAD::setKey(const Bytes& key) {
+        if (key.size() != m_keySize) {
+            throw std::invalid_argument("Invalid AEAD key size");
+        }
+
+        if (!m_encCtx) m_encCtx = makeCipherCtx();
+        if (!m_decCtx) m_decCtx = makeCipherCtx();
+
+        if (EVP_EncryptInit_ex(m_encCtx.get(), m_cipher, nullptr, key.data(), nullptr) != 1)
+            throw std::runtime_error("EncryptInit failed");
+        if (EVP_DecryptInit_ex(m_decCtx.get(), m_cipher, nullptr, key.data(), nullptr) != 1)
+            throw std::runtime_error("DecryptInit failed");
+
+        OPENSSL_cleanse(m_key.data(), m_key.size());
+        m_key = key;
+    }
+
+    void AEAD::setIV(const Bytes& nonce) {
+        if (nonce.size() != NONCE_SIZE) {
+            throw std::invalid_argument("AEAD nonce must be 12 bytes");
+        }
+        m_nonce = nonce;
+        m_nonceUsed = false;
+    }
+
+    void AEAD::setAAD(const Bytes& aad) {
+        m_aad = aad;
+    }
+
+    size_t AEAD::keySize() const noexcept {
+        return m_keySize;
+    }
+
+    void AEAD::requireReady() const {
+        if (m_key.empty() || m_nonce.empty())
+            throw std::runtime_error("Key or nonce not set");
+    }
+
+    void AEAD::consumeNonce() {
+        if (m_nonceUsed) throw std::runtime_error("Nonce already used for encryption; set a new one");
+        m_nonceUsed = true;
+    }
+
+    Bytes AEAD::encrypt(const Bytes& plaintext) {
+        Bytes out(ciphertextSize(plaintext.size()));
+        encrypt(plaintext, out);
+        return out;
+    }
+
+    Bytes AEAD::decrypt(const Bytes& ciphertextAndTag) {
+        if (ciphertextAndTag.size() < TAG_SIZE)
+            throw std::invalid_argument("Ciphertext is shorter than the tag");
+
+        Bytes out(ciphertextAndTag.size() - TAG_SIZE);
+        decrypt(ciphertextAndTag, out);
+        return out;
+    }
+
+    size_t AEAD::encrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
+        requireReady();
+        if (out.size() < ciphertextSize(in.size()))
+            throw std::invalid_argument("Output buffer too small");
+
+        consumeNonce();
+        EVP_CIPHER_CTX* ctx = m_encCtx.get();
+        rearm(ctx, m_nonce, true);
+
+        if (!m_aad.empty()) update_all(ctx, true, nullptr, m_aad.data(), m_aad.size());
+        if (!in.empty()) update_all(ctx, true, out.data(), in.data(), in.size());
+
+        int len = 0;
+        if (EVP_EncryptFinal_ex(ctx, out.data() + in.size(), &len) != 1)
+            throw std::runtime_error("EncryptFinal failed");
+        if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, TAG_SIZE, out.data() + in.size()) != 1)
+            throw std::runtime_error("Failed to read the AEAD tag");
+
+        return ciphertextSize(in.size());
+    }
+
+    size_t AEAD::decrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
+        requireReady();
+        if (in.size() < TAG_SIZE)
+            throw std::invalid_argument("Ciphertext is shorter than the tag");
+
+        size_t size = in.size() - TAG_SIZE;
+        if (out.size() < size)
+            throw std::invalid_argument("Output buffer too small");
+
+        EVP_CIPHER_CTX* ctx = m_decCtx.get();
+        rearm(ctx, m_nonce, false);
+
+        if (!m_aad.empty()) update_all(ctx, false, nullptr, m_aad.data(), m_aad.size());
+        if (size) update_all(ctx, false, out.data(), in.data(), size);
+
+        // The tag is const to us; EVP only copies it
+        uint8_t* tag = const_cast<uint8_t*>(in.data() + size);
+        if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, TAG_SIZE, tag) != 1)
+            throw std::runtime_error("Failed to set the AEAD tag");
+
+        int len = 0;
+        if (EVP_DecryptFinal_ex(ctx, out.data() + size, &len) != 1) {
+            OPENSSL_cleanse(out.data(), size);
+            throw std::runtime_error("AEAD authentication failed");
+        }
+        return size;
+    }
+
+    void AEAD::begin(Direction direction) {
+        requireReady();
+        if (!m_streamCtx) m_streamCtx = makeCipherCtx();
+
+        bool encrypt = direction == Direction::Encrypt;
+        if (encrypt) consumeNonce();
+        int ok = encrypt ? EVP_EncryptInit_ex(m_streamCtx.get(), m_cipher, nullptr, m_key.data(), m_nonce.data())
+                         : EVP_DecryptInit_ex(m_streamCtx.get(), m_cipher, nullptr, m_key.data(), m_nonce.data());
+        if (ok != 1) throw std::runtime_error(encrypt ? "EncryptInit failed" : "DecryptInit failed");
+
+        m_streamDirection = direction;
+        m_streaming = true;
+        m_streamStarted = false;
+    }
+
+    void AEAD::addAAD(const Bytes& aad) {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+        if (m_streamStarted) throw std::runtime_error("AAD must precede the first update");
+
+        if (!aad.empty()) update_all(m_streamCtx.get(), m_streamDirection == Direction::Encrypt, nullptr, aad.data(), aad.size());
+    }
+
+    Bytes AEAD::update(const Bytes& chunk) {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+        m_streamStarted = true;
+
+        Bytes out(chunk.size());
+        try {
+            if (!chunk.empty()) update_all(m_streamCtx.get(), m_streamDirection == Direction::Encrypt, out.data(), chunk.data(), chunk.size());
+        } catch (...) {
+            m_streaming = false;
+            throw;
+        }
+        return out;
+    }
+
+    Bytes AEAD::finalize() {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+        if (m_streamDirection != Direction::Encrypt) throw std::logic_error("Decryption streams finish with finalize(tag)");
+        m_streaming = false;
+
+        uint8_t scratch[16];
+        int len = 0;
+        if (EVP_EncryptFinal_ex(m_streamCtx.get(), scratch, &len) != 1)
+            throw std::runtime_error("EncryptFinal failed");
+
+        Bytes tag(TAG_SIZE);
+        if (EVP_CIPHER_CTX_ctrl(m_streamCtx.get(), EVP_CTRL_AEAD_GET_TAG, TAG_SIZE, tag.data()) != 1)
+            throw std::runtime_error("Failed to read the AEAD tag");
+        return tag;
+    }
+
+    void AEAD::finalize(const Bytes& tag) {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+        if (m_streamDirection != Direction::Decrypt) throw std::logic_error("Encryption streams finish with finalize()");
+        m_streaming = false;
+
+        if (tag.size() != TAG_SIZE) throw std::invalid_argument("AEAD tag must be 16 bytes");
+
+        Bytes expected = tag;
+        if (EVP_CIPHER_CTX_ctrl(m_streamCtx.get(), EVP_CTRL_AEAD_SET_TAG, TAG_SIZE, expected.data()) != 1)
+            throw std::runtime_error("Failed to set the AEAD tag");
+
+        uint8_t scratch[16];
+        int len = 0;
+        if (EVP_DecryptFinal_ex(m_streamCtx.get(), scratch, &len) != 1)
+            throw std::runtime_error("AEAD authentication failed");
+    }
+
+} // namespace crypto::standard::openssl
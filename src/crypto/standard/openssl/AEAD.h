@@ -0,0 +1,89 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <span>
+
+#include "crypto/core/types.h"
+#include "crypto/standard/openssl/EvpContext.h"
+
+// Forward declaration so headers do not pull in <openssl/evp.h>
+struct evp_cipher_st;
+
+namespace crypto::standard::openssl {
+
+    using crypto::core::Bytes;
+
+    // Common EVP plumbing for 96-bit-nonce AEADs with 16-byte tags (AES-GCM, ChaCha20-Poly1305).
+    // Ciphertexts are laid out as ciphertext || tag. A nonce must never be reused with the
+    // same key. Contexts are keyed once in setKey() and driven by encrypt/decrypt (hence
+    // non-const), so an instance is meant for one thread.
+    class AEAD {
+    public:
+        enum class Direction { Encrypt, Decrypt };
+
+        static constexpr size_t NONCE_SIZE = 12;
+        static constexpr size_t TAG_SIZE = 16;
+
+        virtual ~AEAD();
+
+        AEAD(AEAD&&) noexcept = default;
+        AEAD& operator=(AEAD&&) noexcept = default;
+
+        void setKey(const Bytes& key);
+        // A nonce seals one message: encrypt() and begin(Encrypt) throw until setIV() is called
+        // again, since a reused nonce exposes the XOR of the plaintexts and lets tags be forged.
+        // Decryption may reuse it.
+        void setIV(const Bytes& nonce);
+
+        // Additional authenticated data for the following encrypt/decrypt calls
+        void setAAD(const Bytes& aad);
+
+        Bytes encrypt(const Bytes& plaintext);
+        // Throws std::runtime_error if the tag does not verify
+        Bytes decrypt(const Bytes& ciphertextAndTag);
+
+        static constexpr size_t ciphertextSize(size_t plaintextSize) noexcept {
+            return plaintextSize + TAG_SIZE;
+        }
+
+        // Caller-provided output: encrypt needs ciphertextSize(in.size()) bytes, decrypt
+        // in.size() - TAG_SIZE. Returns the number of bytes written.
+        size_t encrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+        size_t decrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+        // Streaming with the current key and nonce. AAD may be added until the first update().
+        // finalize() returns the tag when encrypting; decryption is checked against finalize(tag).
+        // Decrypted chunks are unauthenticated until finalize(tag) returns.
+        void begin(Direction direction);
+        void addAAD(const Bytes& aad);
+        Bytes update(const Bytes& chunk);
+        Bytes finalize();
+        void finalize(const Bytes& tag);
+
+        size_t keySize() const noexcept;
+
+    protected:
+        AEAD(const evp_cipher_st* cipher, size_t keySize);
+
+    private:
+        const evp_cipher_st* m_cipher;
+        size_t m_keySize;
+
+        Bytes m_key;
+        Bytes m_nonce;
+        bool m_nonceUsed = false;   // m_nonce has already sealed a message
+        Bytes m_aad;
+
+        EvpCipherCtx m_encCtx;
+        EvpCipherCtx m_decCtx;
+        EvpCipherCtx m_streamCtx;
+        bool m_streaming = false;
+        bool m_streamStarted = false;
+        Direction m_streamDirection = Direction::Encrypt;
+
+        void requireReady() const;
+        // Marks m_nonce as spent, or throws if it already is
+        void consumeNonce();
+    };
+
+} // namespace crypto::standard::openssl
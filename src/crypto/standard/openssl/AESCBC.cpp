@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <algorithm>
 
 #include <openssl/evp.h>
 
@@ -16,6 +17,13 @@ namespace crypto::standard::openssl {
         }
     }
 
+    // Keeps the key schedule of an initialized context and only resets IV and buffered state
+    static void rearm(EVP_CIPHER_CTX* ctx, const Bytes& iv, bool encrypt) {
+        int ok = encrypt ? EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, iv.data())
+                         : EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, iv.data());
+        if (ok != 1) throw std::runtime_error(encrypt ? "EncryptInit failed" : "DecryptInit failed");
+    }
+
     AESCBC::AESCBC(AESKeySize keySize): m_keySize(keySize) {}
 
     AESCBC::~AESCBC() {
@@ -27,6 +35,19 @@ namespace crypto::standard::openssl {
         if (key.size() != static_cast<size_t>(m_keySize)) {
             throw std::invalid_argument("Invalid AES key size");
         }
+
+        const EVP_CIPHER* cipher = cipher_from_key_size(m_keySize);
+        if (!cipher) throw std::runtime_error("Unsupported AES key size");
+
+        if (!m_encCtx) m_encCtx = makeCipherCtx();
+        if (!m_decCtx) m_decCtx = makeCipherCtx();
+
+        if (EVP_EncryptInit_ex(m_encCtx.get(), cipher, nullptr, key.data(), nullptr) != 1)
+            throw std::runtime_error("EncryptInit failed");
+        if (EVP_DecryptInit_ex(m_decCtx.get(), cipher, nullptr, key.data(), nullptr) != 1)
+            throw std::runtime_error("DecryptInit failed");
+
+        OPENSSL_cleanse(m_key.data(), m_key.size());
         m_key = key;
     }
 
@@ -48,73 +69,138 @@ namespace crypto::standard::openssl {
 
 
 
-    Bytes AESCBC::encrypt(const Bytes& plaintext) const {
+    Bytes AESCBC::encrypt(const Bytes& plaintext) {
+        Bytes ciphertext(ciphertextSize(plaintext.size()));
+        encrypt(plaintext, ciphertext);
+        return ciphertext;
+    }
+
+    Bytes AESCBC::decrypt(const Bytes& ciphertext) {
+        Bytes plaintext(ciphertext.size());
+        plaintext.resize(decrypt(ciphertext, plaintext));
+        return plaintext;
+    }
+
+    size_t AESCBC::encrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
         if (m_key.empty() || m_iv.empty())
             throw std::runtime_error("Key or IV not set");
+        if (out.size() < ciphertextSize(in.size()))
+            throw std::invalid_argument("Output buffer too small");
 
-        EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
-        if (!ctx) throw std::runtime_error("EVP_CIPHER_CTX_new failed");
-
-        const EVP_CIPHER* cipher = cipher_from_key_size(m_keySize);
-        if (!cipher) throw std::runtime_error("Unsupported AES key size");
+        EVP_CIPHER_CTX* ctx = m_encCtx.get();
+        rearm(ctx, m_iv, true);
 
-        Bytes ciphertext(plaintext.size() + blockSize());
         int len = 0, total = 0;
 
-        if (EVP_EncryptInit_ex(ctx, cipher, nullptr, m_key.data(), m_iv.data()) != 1)
-            throw std::runtime_error("EncryptInit failed");
-
-        if (EVP_EncryptUpdate(ctx, ciphertext.data(), &len,
-                            plaintext.data(),
-                            static_cast<int>(plaintext.size())) != 1)
+        if (EVP_EncryptUpdate(ctx, out.data(), &len,
+                            in.data(),
+                            static_cast<int>(in.size())) != 1)
             throw std::runtime_error("EncryptUpdate failed");
 
         total = len;
 
-        if (EVP_EncryptFinal_ex(ctx, ciphertext.data() + len, &len) != 1)
+        if (EVP_EncryptFinal_ex(ctx, out.data() + len, &len) != 1)
             throw std::runtime_error("EncryptFinal failed");
 
         total += len;
-        ciphertext.resize(total);
-
-        EVP_CIPHER_CTX_free(ctx);
-        return ciphertext;
+        return static_cast<size_t>(total);
     }
-    Bytes AESCBC::decrypt(const Bytes& ciphertext) const {
+
+    size_t AESCBC::decrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
         if (m_key.empty() || m_iv.empty())
             throw std::runtime_error("Key or IV not set");
+        if (out.size() < in.size())
+            throw std::invalid_argument("Output buffer too small");
 
-        EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
-        if (!ctx) throw std::runtime_error("EVP_CIPHER_CTX_new failed");
-
-        const EVP_CIPHER* cipher = cipher_from_key_size(m_keySize);
-        if (!cipher) throw std::runtime_error("Unsupported AES key size");
+        EVP_CIPHER_CTX* ctx = m_decCtx.get();
+        rearm(ctx, m_iv, false);
 
-        Bytes plaintext(ciphertext.size());
+        // With padding on, DecryptUpdate holds the last block back for DecryptFinal,
+        // so in.size() bytes of output are always enough
         int len = 0, total = 0;
 
-        if (EVP_DecryptInit_ex(ctx, cipher, nullptr, m_key.data(), m_iv.data()) != 1)
-            throw std::runtime_error("DecryptInit failed");
-
-        if (EVP_DecryptUpdate(ctx, plaintext.data(), &len,
-                            ciphertext.data(),
-                            static_cast<int>(ciphertext.size())) != 1)
+        if (EVP_DecryptUpdate(ctx, out.data(), &len,
+                            in.data(),
+                            static_cast<int>(in.size())) != 1)
             throw std::runtime_error("DecryptUpdate failed");
 
         total = len;
 
-        if (EVP_DecryptFinal_ex(ctx, plaintext.data() + len, &len) != 1)
+        if (EVP_DecryptFinal_ex(ctx, out.data() + len, &len) != 1) {
+            OPENSSL_cleanse(out.data(), std::min(out.size(), in.size()));
             throw std::runtime_error("DecryptFinal failed");
+        }
 
         total += len;
-        plaintext.resize(total);
+        return static_cast<size_t>(total);
+    }
 
-        EVP_CIPHER_CTX_free(ctx);
-        return plaintext;
+    size_t AESCBC::encryptInPlace(std::span<uint8_t> buffer, size_t plaintextSize) {
+        if (plaintextSize > buffer.size())
+            throw std::invalid_argument("Plaintext size exceeds the buffer");
+
+        // EVP allows in == out exactly; only partially overlapping buffers are rejected
+        return encrypt(buffer.first(plaintextSize), buffer);
+    }
+
+    size_t AESCBC::decryptInPlace(std::span<uint8_t> buffer) {
+        return decrypt(buffer, buffer);
+    }
+
+    void AESCBC::begin(Direction direction) {
+        if (m_key.empty() || m_iv.empty())
+            throw std::runtime_error("Key or IV not set");
+
+        const EVP_CIPHER* cipher = cipher_from_key_size(m_keySize);
+        if (!m_streamCtx) m_streamCtx = makeCipherCtx();
+
+        bool encrypt = direction == Direction::Encrypt;
+        int ok = encrypt ? EVP_EncryptInit_ex(m_streamCtx.get(), cipher, nullptr, m_key.data(), m_iv.data())
+                         : EVP_DecryptInit_ex(m_streamCtx.get(), cipher, nullptr, m_key.data(), m_iv.data());
+        if (ok != 1) throw std::runtime_error(encrypt ? "EncryptInit failed" : "DecryptInit failed");
+
+        m_streamDirection = direction;
+        m_streaming = true;
+    }
+
+    Bytes AESCBC::update(const Bytes& chunk) {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+
+        // At most one block is held back between calls
+        Bytes out(chunk.size() + blockSize());
+        int len = 0;
+        int ok = m_streamDirection == Direction::Encrypt
+            ? EVP_EncryptUpdate(m_streamCtx.get(), out.data(), &len, chunk.data(), static_cast<int>(chunk.size()))
+            : EVP_DecryptUpdate(m_streamCtx.get(), out.data(), &len, chunk.data(), static_cast<int>(chunk.size()));
+        if (ok != 1) {
+            m_streaming = false;
+            throw std::runtime_error("Stream update failed");
+        }
+
+        out.resize(len);
+        return out;
+    }
+
+    Bytes AESCBC::finalize() {
+        if (!m_streaming) throw std::runtime_error("Stream not started");
+        m_streaming = false;
+
+        Bytes out(blockSize());
+        int len = 0;
+        int ok = m_streamDirection == Direction::Encrypt
+            ? EVP_EncryptFinal_ex(m_streamCtx.get(), out.data(), &len)
+            : EVP_DecryptFinal_ex(m_streamCtx.get(), out.data(), &len);
+        if (ok != 1) {
+            OPENSSL_cleanse(out.data(), out.size());
+            throw std::runtime_error(m_streamDirection == Direction::Encrypt ? "EncryptFinal failed" : "DecryptFinal failed");
+        }
+
+        out.resize(len);
+        return out;
     }
 
 
 
 
 
-} // namespace crypto::standard::openssl
\ No newline at end of file
+} // namespace crypto::standard::openssl
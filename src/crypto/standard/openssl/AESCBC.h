@@ -1,9 +1,11 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <span>
 
 
 #include "crypto/core/types.h"
+#include "crypto/standard/openssl/EvpContext.h"
 
 namespace crypto::standard::openssl {
 
@@ -16,16 +18,47 @@ namespace crypto::standard::openssl {
     };
 
 
+    // AES-CBC with PKCS#7 padding. The EVP contexts are created and keyed once in setKey()
+    // and only re-armed with the IV per call; encrypt/decrypt drive them and are therefore
+    // non-const. Use one instance per thread.
     class AESCBC {
     public:
+        enum class Direction { Encrypt, Decrypt };
+
         explicit AESCBC(AESKeySize keySize);
         ~AESCBC();
 
+        AESCBC(AESCBC&&) noexcept = default;
+        AESCBC& operator=(AESCBC&&) noexcept = default;
+
         void setKey(const Bytes& key);
         void setIV(const Bytes& iv);
 
-        Bytes encrypt(const Bytes& plaintext) const;
-        Bytes decrypt(const Bytes& ciphertext) const;
+        Bytes encrypt(const Bytes& plaintext);
+        Bytes decrypt(const Bytes& ciphertext);
+
+        // PKCS#7 always adds 1..16 bytes, so the ciphertext size is known before encrypting.
+        // Decryption writes at most ciphertext.size() bytes.
+        static constexpr size_t ciphertextSize(size_t plaintextSize) noexcept {
+            return (plaintextSize / 16 + 1) * 16;
+        }
+
+        // Caller-provided output: out must hold ciphertextSize(in.size()) bytes for encrypt
+        // and in.size() bytes for decrypt. Returns the number of bytes written.
+        size_t encrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+        size_t decrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+        // In place: the first plaintextSize bytes of buffer are replaced by the ciphertext,
+        // so buffer must hold ciphertextSize(plaintextSize) bytes. Returns the output size.
+        size_t encryptInPlace(std::span<uint8_t> buffer, size_t plaintextSize);
+        size_t decryptInPlace(std::span<uint8_t> buffer);
+
+        // Streaming: begin() starts a message with the current key and IV, update() returns
+        // whatever output is complete so far and finalize() flushes the padding block.
+        // Independent of encrypt()/decrypt(), which may be used while a stream is open.
+        void begin(Direction direction);
+        Bytes update(const Bytes& chunk);
+        Bytes finalize();
 
         size_t keySize() const noexcept;
         size_t blockSize() const noexcept; 
@@ -35,7 +68,11 @@ namespace crypto::standard::openssl {
         Bytes m_iv;
         AESKeySize m_keySize;
 
-        
+        EvpCipherCtx m_encCtx;
+        EvpCipherCtx m_decCtx;
+        EvpCipherCtx m_streamCtx;
+        bool m_streaming = false;
+        Direction m_streamDirection = Direction::Encrypt;
     };
 
 }
@@ -0,0 +1,20 @@
+#include <stdexcept>
+
+#include <openssl/evp.h>
+
+#include "crypto/standard/openssl/AESGCM.h"
+
+namespace crypto::standard::openssl {
+
+    static const EVP_CIPHER* gcm_from_key_size(AESKeySize size) {
+        switch (size) {
+            case AESKeySize::AES_128: return EVP_aes_128_gcm();
+            case AESKeySize::AES_192: return EVP_aes_192_gcm();
+            case AESKeySize::AES_256: return EVP_aes_256_gcm();
+            default: throw std::invalid_argument("Invalid AES key size");
+        }
+    }
+
+    AESGCM::AESGCM(AESKeySize keySize): AEAD(gcm_from_key_size(keySize), static_cast<size_t>(keySize)) {}
+
+} // namespace crypto::standard::openssl
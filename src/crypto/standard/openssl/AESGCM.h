@@ -0,0 +1,14 @@
+#pragma once
+
+#include "crypto/standard/openssl/AEAD.h"
+#include "crypto/standard/openssl/AESCBC.h"
+
+namespace crypto::standard::openssl {
+
+    // AES-GCM with a 96-bit nonce and a 128-bit tag; uses AES-NI/PCLMULQDQ when available
+    class AESGCM final : public AEAD {
+    public:
+        explicit AESGCM(AESKeySize keySize);
+    };
+
+} // namespace crypto::standard::openssl
@@ -0,0 +1,9 @@
+#include <openssl/evp.h>
+
+#include "crypto/standard/openssl/ChaCha20Poly1305.h"
+
+namespace crypto::standard::openssl {
+
+    ChaCha20Poly1305::ChaCha20Poly1305(): AEAD(EVP_chacha20_poly1305(), KEY_SIZE) {}
+
+} // namespace crypto::standard::openssl
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "crypto/standard/openssl/AEAD.h"
+
+namespace crypto::standard::openssl {
+
+    // ChaCha20-Poly1305 (RFC 8439). Fast in software, so the better choice without AES-NI.
+    class ChaCha20Poly1305 final : public AEAD {
+    public:
+        static constexpr size_t KEY_SIZE = 32;
+
+        ChaCha20Poly1305();
+    };
+
+} // namespace crypto::standard::openssl
@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <algorithm>
 #include <openssl/evp.h>
 #include "crypto/standard/openssl/DES.h"
 
@@ -16,6 +17,21 @@ namespace crypto::standard::openssl {
         if (key.size() != 8) {
             throw std::invalid_argument("DES key must be exactly 8 bytes (64 bits)");
         }
+        if (!ensureLegacyProvider()) {
+            throw std::runtime_error("DES is unavailable: the OpenSSL legacy provider could not be loaded");
+        }
+
+        if (!m_encCtx) m_encCtx = makeCipherCtx();
+        if (!m_decCtx) m_decCtx = makeCipherCtx();
+
+        if (EVP_EncryptInit_ex(m_encCtx.get(), EVP_des_cbc(), nullptr, key.data(), nullptr) != 1) {
+            throw std::runtime_error("DES encryption initialization failed");
+        }
+        if (EVP_DecryptInit_ex(m_decCtx.get(), EVP_des_cbc(), nullptr, key.data(), nullptr) != 1) {
+            throw std::runtime_error("DES decryption initialization failed");
+        }
+
+        OPENSSL_cleanse(m_key.data(), m_key.size());
         m_key = key;
     }
 
@@ -26,71 +42,85 @@ namespace crypto::standard::openssl {
         m_iv = iv;
     }
 
-    Bytes DES::encrypt(const Bytes& plaintext) const {
+    Bytes DES::encrypt(const Bytes& plaintext) {
+        Bytes ciphertext(ciphertextSize(plaintext.size()));
+        encrypt(plaintext, ciphertext);
+        return ciphertext;
+    }
+
+    Bytes DES::decrypt(const Bytes& ciphertext) {
+        Bytes plaintext(ciphertext.size());
+        plaintext.resize(decrypt(ciphertext, plaintext));
+        return plaintext;
+    }
+
+    size_t DES::encrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
         if (m_key.empty() || m_iv.empty()) {
             throw std::runtime_error("Key or IV not set for DES");
         }
+        if (out.size() < ciphertextSize(in.size())) {
+            throw std::invalid_argument("Output buffer too small");
+        }
 
-        EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
-        if (!ctx) throw std::runtime_error("Failed to create EVP context");
-
-        // Initialize DES CBC
-        if (EVP_EncryptInit_ex(ctx, EVP_des_cbc(), nullptr, m_key.data(), m_iv.data()) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        // Re-arm the keyed context with the IV
+        EVP_CIPHER_CTX* ctx = m_encCtx.get();
+        if (EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, m_iv.data()) != 1) {
             throw std::runtime_error("DES encryption initialization failed");
         }
 
-        Bytes ciphertext(plaintext.size() + blockSize());
         int len = 0, total = 0;
 
-        if (EVP_EncryptUpdate(ctx, ciphertext.data(), &len, plaintext.data(), static_cast<int>(plaintext.size())) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        if (EVP_EncryptUpdate(ctx, out.data(), &len, in.data(), static_cast<int>(in.size())) != 1) {
             throw std::runtime_error("DES encryption update failed");
         }
         total = len;
 
-        if (EVP_EncryptFinal_ex(ctx, ciphertext.data() + len, &len) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        if (EVP_EncryptFinal_ex(ctx, out.data() + len, &len) != 1) {
             throw std::runtime_error("DES encryption finalization failed");
         }
         total += len;
 
-        ciphertext.resize(total);
-        EVP_CIPHER_CTX_free(ctx);
-        return ciphertext;
+        return static_cast<size_t>(total);
     }
 
-    Bytes DES::decrypt(const Bytes& ciphertext) const {
+    size_t DES::decrypt(std::span<const uint8_t> in, std::span<uint8_t> out) {
         if (m_key.empty() || m_iv.empty()) {
             throw std::runtime_error("Key or IV not set for DES");
         }
+        if (out.size() < in.size()) {
+            throw std::invalid_argument("Output buffer too small");
+        }
 
-        EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
-        if (!ctx) throw std::runtime_error("Failed to create EVP context");
-
-        if (EVP_DecryptInit_ex(ctx, EVP_des_cbc(), nullptr, m_key.data(), m_iv.data()) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        EVP_CIPHER_CTX* ctx = m_decCtx.get();
+        if (EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, m_iv.data()) != 1) {
             throw std::runtime_error("DES decryption initialization failed");
         }
 
-        Bytes plaintext(ciphertext.size());
         int len = 0, total = 0;
 
-        if (EVP_DecryptUpdate(ctx, plaintext.data(), &len, ciphertext.data(), static_cast<int>(ciphertext.size())) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        if (EVP_DecryptUpdate(ctx, out.data(), &len, in.data(), static_cast<int>(in.size())) != 1) {
             throw std::runtime_error("DES decryption update failed");
         }
         total = len;
 
-        if (EVP_DecryptFinal_ex(ctx, plaintext.data() + len, &len) != 1) {
-            EVP_CIPHER_CTX_free(ctx);
+        if (EVP_DecryptFinal_ex(ctx, out.data() + len, &len) != 1) {
+            OPENSSL_cleanse(out.data(), std::min(out.size(), in.size()));
             throw std::runtime_error("DES decryption finalization failed");
         }
         total += len;
 
-        plaintext.resize(total);
-        EVP_CIPHER_CTX_free(ctx);
-        return plaintext;
+        return static_cast<size_t>(total);
+    }
+
+    size_t DES::encryptInPlace(std::span<uint8_t> buffer, size_t plaintextSize) {
+        if (plaintextSize > buffer.size()) {
+            throw std::invalid_argument("Plaintext size exceeds the buffer");
+        }
+        return encrypt(buffer.first(plaintextSize), buffer);
+    }
+
+    size_t DES::decryptInPlace(std::span<uint8_t> buffer) {
+        return decrypt(buffer, buffer);
     }
 
-} // namespace crypto::standard::openssl
\ No newline at end of file
+} // namespace crypto::standard::openssl
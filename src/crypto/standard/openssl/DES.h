@@ -1,7 +1,9 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <span>
 #include "crypto/core/types.h"
+#include "crypto/standard/openssl/EvpContext.h"
 
 namespace crypto::standard::openssl {
 
@@ -11,17 +13,38 @@ namespace crypto::standard::openssl {
      * @brief Wrapper for OpenSSL's DES implementation in CBC mode.
      * Block size: 8 bytes
      * Key size: 8 bytes
+     *
+     * On OpenSSL 3 DES lives in the legacy provider, which is loaded on first use.
+     * Contexts are keyed once in setKey() and driven by encrypt/decrypt (hence non-const),
+     * so an instance is meant for one thread at a time.
      */
     class DES {
     public:
         DES();
         ~DES();
 
+        DES(DES&&) noexcept = default;
+        DES& operator=(DES&&) noexcept = default;
+
         void setKey(const Bytes& key);
         void setIV(const Bytes& iv);
 
-        Bytes encrypt(const Bytes& plaintext) const;
-        Bytes decrypt(const Bytes& ciphertext) const;
+        Bytes encrypt(const Bytes& plaintext);
+        Bytes decrypt(const Bytes& ciphertext);
+
+        // PKCS#7 always adds 1..8 bytes, so the ciphertext size is known before encrypting
+        static constexpr size_t ciphertextSize(size_t plaintextSize) noexcept {
+            return (plaintextSize / 8 + 1) * 8;
+        }
+
+        // Caller-provided output: out must hold ciphertextSize(in.size()) bytes for encrypt
+        // and in.size() bytes for decrypt. Returns the number of bytes written.
+        size_t encrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+        size_t decrypt(std::span<const uint8_t> in, std::span<uint8_t> out);
+
+        // In place; buffer must hold ciphertextSize(plaintextSize) bytes
+        size_t encryptInPlace(std::span<uint8_t> buffer, size_t plaintextSize);
+        size_t decryptInPlace(std::span<uint8_t> buffer);
 
         size_t keySize() const noexcept { return 8; }
         size_t blockSize() const noexcept { return 8; }
@@ -29,6 +52,9 @@ namespace crypto::standard::openssl {
     private:
         Bytes m_key;
         Bytes m_iv;
+
+        EvpCipherCtx m_encCtx;
+        EvpCipherCtx m_decCtx;
     };
 
-} // namespace crypto::standard::openssl
\ No newline at end of file
+} // namespace crypto::standard::openssl
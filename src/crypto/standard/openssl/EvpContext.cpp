@@ -0,0 +1,40 @@
+#include <stdexcept>
+#include <mutex>
+
+#include <openssl/evp.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    #include <openssl/provider.h>
+#endif
+
+#include "crypto/standard/openssl/EvpContext.h"
+
+namespace crypto::standard::openssl {
+
+    void EvpCipherCtxDeleter::operator()(evp_cipher_ctx_st* ctx) const noexcept {
+        EVP_CIPHER_CTX_free(ctx);
+    }
+
+    EvpCipherCtx makeCipherCtx() {
+        EvpCipherCtx ctx(EVP_CIPHER_CTX_new());
+        if (!ctx) throw std::runtime_error("EVP_CIPHER_CTX_new failed");
+        return ctx;
+    }
+
+    bool ensureLegacyProvider() {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+        static std::once_flag once;
+        static bool available = false;
+
+        // Providers stay loaded for the life of the process
+        std::call_once(once, [] {
+            OSSL_PROVIDER* legacy = OSSL_PROVIDER_load(nullptr, "legacy");
+            OSSL_PROVIDER* fallback = OSSL_PROVIDER_load(nullptr, "default");
+            available = legacy != nullptr && fallback != nullptr;
+        });
+        return available;
+#else
+        return true;
+#endif
+    }
+
+} // namespace crypto::standard::openssl
@@ -0,0 +1,24 @@
+#pragma once
+#include <memory>
+
+// Forward declaration so headers do not pull in <openssl/evp.h>
+struct evp_cipher_ctx_st;
+
+namespace crypto::standard::openssl {
+
+    struct EvpCipherCtxDeleter {
+        void operator()(evp_cipher_ctx_st* ctx) const noexcept;
+    };
+
+    // Owning EVP_CIPHER_CTX; freed (and cleansed) on every path, including exceptions
+    using EvpCipherCtx = std::unique_ptr<evp_cipher_ctx_st, EvpCipherCtxDeleter>;
+
+    // Throws std::runtime_error if OpenSSL cannot allocate the context
+    EvpCipherCtx makeCipherCtx();
+
+    // OpenSSL 3 moved DES and other retired ciphers to the "legacy" provider, and loading any
+    // provider explicitly stops "default" from being loaded implicitly. Loads both, once per
+    // process; returns whether legacy is available (always true before OpenSSL 3).
+    bool ensureLegacyProvider();
+
+} // namespace crypto::standard::openssl
@@ -0,0 +1,227 @@
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <stdexcept>
+#include <mutex>
+#include <array>
+#include <thread>
+#include <exception>
+#include <algorithm>
+
+#include "crypto/standard/openssl/RSAKey.h"
+
+
+namespace {
+    using crypto::core::Bytes;
+
+    struct BioDeleter { void operator()(BIO* bio) const noexcept { BIO_free(bio); } };
+    struct PkeyCtxDeleter { void operator()(EVP_PKEY_CTX* ctx) const noexcept { EVP_PKEY_CTX_free(ctx); } };
+
+    using BioPtr = std::unique_ptr<BIO, BioDeleter>;
+    using PkeyCtxPtr = std::unique_ptr<EVP_PKEY_CTX, PkeyCtxDeleter>;
+
+    std::shared_ptr<EVP_PKEY> parse_pem(const Bytes& pem, bool isPrivate) {
+        BioPtr bio(BIO_new_mem_buf(pem.data(), static_cast<int>(pem.size())));
+        if (!bio) throw std::runtime_error("BIO_new_mem_buf failed");
+
+        EVP_PKEY* key = isPrivate ? PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr)
+                                  : PEM_read_bio_PUBKEY(bio.get(), nullptr, nullptr, nullptr);
+        if (!key) throw std::runtime_error(isPrivate ? "Invalid private key" : "Invalid public key");
+        if (EVP_PKEY_base_id(key) != EVP_PKEY_RSA) {
+            EVP_PKEY_free(key);
+            throw std::runtime_error("Key is not an RSA key");
+        }
+        return std::shared_ptr<EVP_PKEY>(key, EVP_PKEY_free);
+    }
+
+    PkeyCtxPtr make_oaep_ctx(EVP_PKEY* key, bool encrypt) {
+        PkeyCtxPtr ctx(EVP_PKEY_CTX_new(key, nullptr));
+        if (!ctx) throw std::runtime_error("CTX new failed");
+
+        if ((encrypt ? EVP_PKEY_encrypt_init(ctx.get()) : EVP_PKEY_decrypt_init(ctx.get())) <= 0)
+            throw std::runtime_error(encrypt ? "Encrypt init failed" : "Decrypt init failed");
+
+        if (EVP_PKEY_CTX_set_rsa_padding(ctx.get(), RSA_PKCS1_OAEP_PADDING) <= 0 ||
+            EVP_PKEY_CTX_set_rsa_oaep_md(ctx.get(), EVP_sha256()) <= 0 ||
+            EVP_PKEY_CTX_set_rsa_mgf1_md(ctx.get(), EVP_sha256()) <= 0)
+            throw std::runtime_error("Setting OAEP parameters failed");
+
+        return ctx;
+    }
+
+    template <typename Op>
+    std::vector<Bytes> run_batch(const std::vector<Bytes>& inputs, unsigned threads, Op op) {
+        std::vector<Bytes> results(inputs.size());
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, inputs.size())));
+
+        std::vector<std::exception_ptr> errors(threads);
+        auto work = [&](unsigned t) {
+            size_t begin = inputs.size() * t / threads;
+            size_t end = inputs.size() * (t + 1) / threads;
+            try {
+                for (size_t i = begin; i < end; ++i) results[i] = op(inputs[i]);
+            } catch (...) {
+                errors[t] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned t = 1; t < threads; ++t) workers.emplace_back(work, t);
+        work(0);
+        for (auto& worker : workers) worker.join();
+
+        for (auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+        return results;
+    }
+}
+
+
+namespace crypto::standard::openssl {
+
+    // Every context created for one key, each used by the thread that created it
+    struct RSAKey::Contexts {
+        std::mutex mutex;
+        std::vector<PkeyCtxPtr> owned;
+
+        EVP_PKEY_CTX* add(PkeyCtxPtr ctx) {
+            std::lock_guard<std::mutex> lock(mutex);
+            owned.push_back(std::move(ctx));
+            return owned.back().get();
+        }
+
+        void drop(EVP_PKEY_CTX* ctx) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = std::find_if(owned.begin(), owned.end(), [ctx](const PkeyCtxPtr& p) { return p.get() == ctx; });
+            if (it != owned.end()) owned.erase(it);
+        }
+    };
+
+    RSAKey::RSAKey(std::shared_ptr<evp_pkey_st> key, bool isPrivate, bool cached)
+        : m_key(std::move(key)), m_private(isPrivate),
+          m_contexts(cached ? std::make_shared<Contexts>() : nullptr) {}
+
+    RSAKey RSAKey::fromPublicPem(const Bytes& pem) {
+        return RSAKey(parse_pem(pem, false), false, true);
+    }
+
+    RSAKey RSAKey::fromPrivatePem(const Bytes& pem) {
+        return RSAKey(parse_pem(pem, true), true, true);
+    }
+
+    Bytes RSAKey::encryptOnce(const Bytes& publicPem, const Bytes& plaintext) {
+        return RSAKey(parse_pem(publicPem, false), false, false).encrypt(plaintext);
+    }
+
+    Bytes RSAKey::decryptOnce(const Bytes& privatePem, const Bytes& ciphertext) {
+        return RSAKey(parse_pem(privatePem, true), true, false).decrypt(ciphertext);
+    }
+
+    // Small per-thread cache of slots pointing into the keys' Contexts, recycled round-robin.
+    // A slot only matches while its key is alive, so a dangling ctx pointer is never used.
+    evp_pkey_ctx_st* RSAKey::threadContext(bool encrypt) const {
+        if (!m_contexts) return nullptr;
+
+        struct Slot {
+            std::weak_ptr<Contexts> owner;
+            bool encrypt = false;
+            EVP_PKEY_CTX* ctx = nullptr;
+
+            // Hands the context back to its key, if the key is still alive
+            void release() {
+                if (auto contexts = owner.lock()) contexts->drop(ctx);
+                owner.reset();
+                ctx = nullptr;
+            }
+            ~Slot() { release(); }
+        };
+        constexpr size_t kSlots = 8;
+        thread_local std::array<Slot, kSlots> slots;
+        thread_local size_t next = 0;
+
+        for (auto& slot : slots) {
+            // Same control block as m_contexts: the key this handle holds, so it is alive
+            bool sameKey = !slot.owner.owner_before(m_contexts) && !m_contexts.owner_before(slot.owner);
+            if (slot.ctx && sameKey && slot.encrypt == encrypt) return slot.ctx;
+        }
+
+        Slot& slot = slots[next];
+        next = (next + 1) % kSlots;
+        slot.release();
+        slot.ctx = m_contexts->add(make_oaep_ctx(m_key.get(), encrypt));
+        slot.owner = m_contexts;
+        slot.encrypt = encrypt;
+        return slot.ctx;
+    }
+
+    size_t RSAKey::cachedContexts() const {
+        if (!m_contexts) return 0;
+        std::lock_guard<std::mutex> lock(m_contexts->mutex);
+        return m_contexts->owned.size();
+    }
+
+    bool RSAKey::isPrivate() const noexcept {
+        return m_private;
+    }
+
+    size_t RSAKey::bits() const noexcept {
+        return static_cast<size_t>(EVP_PKEY_bits(m_key.get()));
+    }
+
+    size_t RSAKey::ciphertextSize() const noexcept {
+        return static_cast<size_t>(EVP_PKEY_size(m_key.get()));
+    }
+
+    size_t RSAKey::maxPlaintextSize() const noexcept {
+        // Moduli under 66 bytes cannot carry any OAEP-SHA-256 plaintext
+        size_t k = ciphertextSize();
+        return k > 2 * 32 + 2 ? k - 2 * 32 - 2 : 0;
+    }
+
+    Bytes RSAKey::encrypt(const Bytes& plaintext) const {
+        if (plaintext.size() > maxPlaintextSize())
+            throw std::runtime_error("Plaintext too long for RSA-OAEP");
+
+        PkeyCtxPtr oneShot;
+        EVP_PKEY_CTX* ctx = threadContext(true);
+        if (!ctx) ctx = (oneShot = make_oaep_ctx(m_key.get(), true)).get();
+
+        size_t out_len = ciphertextSize();
+        Bytes ciphertext(out_len);
+
+        if (EVP_PKEY_encrypt(ctx, ciphertext.data(), &out_len, plaintext.data(), plaintext.size()) <= 0)
+            throw std::runtime_error("Encrypt failed");
+
+        ciphertext.resize(out_len);
+        return ciphertext;
+    }
+
+    Bytes RSAKey::decrypt(const Bytes& ciphertext) const {
+        if (!m_private) throw std::runtime_error("Decryption requires a private key");
+
+        PkeyCtxPtr oneShot;
+        EVP_PKEY_CTX* ctx = threadContext(false);
+        if (!ctx) ctx = (oneShot = make_oaep_ctx(m_key.get(), false)).get();
+
+        size_t out_len = ciphertextSize();
+        Bytes plaintext(out_len);
+
+        if (EVP_PKEY_decrypt(ctx, plaintext.data(), &out_len, ciphertext.data(), ciphertext.size()) <= 0)
+            throw std::runtime_error("Decrypt failed");
+
+        plaintext.resize(out_len);
+        return plaintext;
+    }
+
+    std::vector<Bytes> RSAKey::encryptBatch(const std::vector<Bytes>& plaintexts, unsigned threads) const {
+        return run_batch(plaintexts, threads, [this](const Bytes& in) { return encrypt(in); });
+    }
+
+    std::vector<Bytes> RSAKey::decryptBatch(const std::vector<Bytes>& ciphertexts, unsigned threads) const {
+        if (!m_private) throw std::runtime_error("Decryption requires a private key");
+        return run_batch(ciphertexts, threads, [this](const Bytes& in) { return decrypt(in); });
+    }
+
+} // namespace crypto::standard::openssl
@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+#include "crypto/core/types.h"
+
+// Forward declarations so headers do not pull in <openssl/evp.h>
+struct evp_pkey_st;
+struct evp_pkey_ctx_st;
+
+namespace crypto::standard::openssl {
+
+    using crypto::core::Bytes;
+
+    // A PEM key parsed once into an EVP_PKEY for RSA-OAEP (SHA-256, MGF1-SHA-256).
+    // Handles are cheap to copy and safe to share across threads: each thread keeps its own
+    // initialized EVP_PKEY_CTX per key, so repeated operations skip both parsing and setup.
+    // The contexts belong to the key, not the threads: they (and the key material they reference)
+    // are freed when the last handle goes away, and a thread's contexts when that thread exits.
+    class RSAKey {
+    public:
+        static RSAKey fromPublicPem(const Bytes& pem);
+        static RSAKey fromPrivatePem(const Bytes& pem);
+
+        // One-shot PEM operations with a throwaway context; nothing enters the per-thread caches
+        static Bytes encryptOnce(const Bytes& publicPem, const Bytes& plaintext);
+        static Bytes decryptOnce(const Bytes& privatePem, const Bytes& ciphertext);
+
+        bool isPrivate() const noexcept;
+        size_t bits() const noexcept;
+
+        // Modulus size in bytes, which is the size of every ciphertext
+        size_t ciphertextSize() const noexcept;
+        // Largest OAEP-SHA-256 plaintext: k - 2 * 32 - 2, or 0 for moduli under 66 bytes
+        size_t maxPlaintextSize() const noexcept;
+
+        Bytes encrypt(const Bytes& plaintext) const;
+        // Requires a private key
+        Bytes decrypt(const Bytes& ciphertext) const;
+
+        // Batches split into contiguous ranges across `threads` workers (0 = one per hardware
+        // thread). Results keep the input order; the first failure is rethrown after all workers join.
+        std::vector<Bytes> encryptBatch(const std::vector<Bytes>& plaintexts, unsigned threads = 1) const;
+        std::vector<Bytes> decryptBatch(const std::vector<Bytes>& ciphertexts, unsigned threads = 0) const;
+
+        // Contexts currently cached for this key, over all threads
+        size_t cachedContexts() const;
+
+    private:
+        struct Contexts;
+
+        RSAKey(std::shared_ptr<evp_pkey_st> key, bool isPrivate, bool cached);
+
+        // This thread's context for the key, or nullptr for an uncached (one-shot) handle
+        evp_pkey_ctx_st* threadContext(bool encrypt) const;
+
+        std::shared_ptr<evp_pkey_st> m_key;
+        bool m_private;
+        std::shared_ptr<Contexts> m_contexts;   // null for one-shot handles
+    };
+
+} // namespace crypto::standard::openssl
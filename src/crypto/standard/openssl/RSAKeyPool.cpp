@@ -0,0 +1,164 @@
+#include <stdexcept>
+#include <algorithm>
+#include <optional>
+
+#include "crypto/standard/openssl/RSAKeyPool.h"
+#include "crypto/standard/openssl/RSA.h"
+
+namespace crypto::standard::openssl {
+
+    RSAKeyPool::RSAKeyPool(unsigned threads) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+        m_workers.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    RSAKeyPool::~RSAKeyPool() {
+        std::deque<Request> abandoned;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+            abandoned.swap(m_requests);
+        }
+        m_wake.notify_all();
+
+        for (auto& request : abandoned) {
+            request.promise.set_exception(std::make_exception_ptr(std::runtime_error("RSAKeyPool stopped")));
+        }
+        for (auto& worker : m_workers) worker.join();
+    }
+
+    unsigned RSAKeyPool::threads() const noexcept {
+        return static_cast<unsigned>(m_workers.size());
+    }
+
+    std::future<KeyPair> RSAKeyPool::generate(size_t bits) {
+        std::promise<KeyPair> promise;
+        auto future = promise.get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_requests.push_back({bits, std::move(promise)});
+        }
+        m_wake.notify_one();
+        return future;
+    }
+
+    std::vector<std::future<KeyPair>> RSAKeyPool::generate(size_t bits, size_t count) {
+        std::vector<std::future<KeyPair>> futures;
+        futures.reserve(count);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t i = 0; i < count; ++i) {
+                std::promise<KeyPair> promise;
+                futures.push_back(promise.get_future());
+                m_requests.push_back({bits, std::move(promise)});
+            }
+        }
+        m_wake.notify_all();
+        return futures;
+    }
+
+    void RSAKeyPool::reserve(size_t bits, size_t target) {
+        if (bits < MIN_BITS) throw std::invalid_argument("RSA key size too small for the stock");
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Stock& stock = m_stocks[bits];
+            stock.target = target;
+            stock.error = nullptr;
+            while (stock.ready.size() > target) stock.ready.pop_front();
+        }
+        m_wake.notify_all();
+    }
+
+    std::future<KeyPair> RSAKeyPool::acquire(size_t bits) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_stocks.find(bits);
+            if (it != m_stocks.end() && !it->second.ready.empty()) {
+                std::promise<KeyPair> promise;
+                promise.set_value(std::move(it->second.ready.front()));
+                it->second.ready.pop_front();
+                m_wake.notify_one(); // refill what was taken
+                return promise.get_future();
+            }
+        }
+        return generate(bits);
+    }
+
+    size_t RSAKeyPool::stocked(size_t bits) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_stocks.find(bits);
+        return it == m_stocks.end() ? 0 : it->second.ready.size();
+    }
+
+    std::exception_ptr RSAKeyPool::stockError(size_t bits) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_stocks.find(bits);
+        return it == m_stocks.end() ? nullptr : it->second.error;
+    }
+
+    size_t RSAKeyPool::stockDeficit() const {
+        size_t bits = 0, worst = 0;
+        for (const auto& [size, stock] : m_stocks) {
+            size_t have = stock.ready.size() + stock.inFlight;
+            if (have < stock.target && stock.target - have > worst) {
+                worst = stock.target - have;
+                bits = size;
+            }
+        }
+        return bits;
+    }
+
+    void RSAKeyPool::workerLoop() {
+        RSA rsa;
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true) {
+            m_wake.wait(lock, [this] { return m_stopping || !m_requests.empty() || stockDeficit() != 0; });
+            if (m_stopping) return;
+
+            if (!m_requests.empty()) {
+                Request request = std::move(m_requests.front());
+                m_requests.pop_front();
+                lock.unlock();
+
+                try {
+                    request.promise.set_value(rsa.generateKeyPair(request.bits));
+                } catch (...) {
+                    request.promise.set_exception(std::current_exception());
+                }
+
+                lock.lock();
+                continue;
+            }
+
+            size_t bits = stockDeficit();
+            m_stocks[bits].inFlight++;
+            lock.unlock();
+
+            std::optional<KeyPair> key;
+            std::exception_ptr error;
+            try {
+                key = rsa.generateKeyPair(bits);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            Stock& stock = m_stocks[bits];
+            stock.inFlight--;
+            if (error) {
+                // Retrying right away would spin on a persistent failure (e.g. a provider
+                // rejecting the size); stop refilling until reserve() is called again
+                stock.target = 0;
+                stock.error = error;
+            } else if (stock.ready.size() < stock.target) {
+                stock.ready.push_back(std::move(*key));
+            }
+        }
+    }
+
+} // namespace crypto::standard::openssl
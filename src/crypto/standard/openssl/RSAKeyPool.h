@@ -0,0 +1,77 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "crypto/core/asymmetric/IAsymmetricCipher.h"
+
+namespace crypto::standard::openssl {
+
+    using crypto::core::asymmetric::KeyPair;
+
+    // Generates RSA keypairs (PEM, as RSA::generateKeyPair) on a fixed set of worker threads.
+    // Explicit requests are served first; idle workers top up a per-size stock of ready keys
+    // configured with reserve(), which acquire() hands out without waiting.
+    class RSAKeyPool {
+    public:
+        // Smallest modulus accepted by reserve()
+        static constexpr size_t MIN_BITS = 1024;
+
+        // threads == 0 means one per hardware thread
+        explicit RSAKeyPool(unsigned threads = 0);
+
+        // Joins the workers after their current key; requests still queued fail with std::runtime_error
+        ~RSAKeyPool();
+
+        RSAKeyPool(const RSAKeyPool&) = delete;
+        RSAKeyPool& operator=(const RSAKeyPool&) = delete;
+
+        std::future<KeyPair> generate(size_t bits);
+        std::vector<std::future<KeyPair>> generate(size_t bits, size_t count);
+
+        // Keeps `target` keys of `bits` bits ready in the background; 0 stops refilling.
+        // If generating a stock key fails, refilling that size stops (target drops to 0) and the
+        // error is kept for stockError(); calling reserve() again clears it and resumes.
+        void reserve(size_t bits, size_t target);
+
+        // A stocked key if one is ready (the future is already satisfied), otherwise a queued request
+        std::future<KeyPair> acquire(size_t bits);
+
+        size_t stocked(size_t bits) const;
+        // Failure that stopped refilling `bits`, or null
+        std::exception_ptr stockError(size_t bits) const;
+        unsigned threads() const noexcept;
+
+    private:
+        struct Request {
+            size_t bits;
+            std::promise<KeyPair> promise;
+        };
+
+        struct Stock {
+            size_t target = 0;
+            size_t inFlight = 0;    // stock keys being generated right now
+            std::deque<KeyPair> ready;
+            std::exception_ptr error;
+        };
+
+        void workerLoop();
+        // Size whose stock is furthest below target, or 0 if every stock is full (m_mutex held)
+        size_t stockDeficit() const;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::deque<Request> m_requests;
+        std::map<size_t, Stock> m_stocks;
+        bool m_stopping = false;
+
+        std::vector<std::thread> m_workers;
+    };
+
+} // namespace crypto::standard::openssl
@@ -1,8 +1,10 @@
 #include <iostream>
+#include <stdexcept>
 #include "net/client/Client.h"
 
 using net::protocol::Message;
 using net::protocol::MessageType;
+using net::protocol::BodyEncoding;
 using net::protocol::kHeaderSize;
 using net::protocol::kTypeFieldSize;
 using net::protocol::kLengthFieldSize;
@@ -11,8 +13,30 @@ using boost::asio::ip::tcp;
 
 namespace net::client {
     
-    Client::Client(boost::asio::io_context& io, std::unique_ptr<ITransport> transport, RunMode mode)
-        : mIoContext(io), mTransport(std::move(transport)), mRunMode(mode) {
+    namespace {
+        constexpr std::chrono::milliseconds kSweepInterval{10};
+
+        size_t roundUpPow2(size_t n) {
+            size_t size = 1;
+            while (size < n) size <<= 1;
+            return size;
+        }
+    }
+
+    Client::Client(boost::asio::io_context& io, std::unique_ptr<ITransport> transport, RunMode mode, BodyEncoding encoding)
+        : mIoContext(io), mTransport(std::move(transport)), mRunMode(mode), mEncoding(encoding), mSweepTimer(io) {
+        configurePipeline(mPipeline);
+    }
+
+    void Client::configurePipeline(const PipelineOptions& options) {
+        if (mIsRunning) throw std::logic_error("Client: configurePipeline() must be called before connect()");
+        if (options.maxInFlight == 0) throw std::invalid_argument("Client: maxInFlight must be non-zero");
+
+        std::lock_guard<std::mutex> lock(mSlotMutex);
+        mPipeline = options;
+        mSlots.assign(roundUpPow2(options.maxInFlight), Slot{});
+        mInFlight = 0;
+        mTimedInFlight = 0;
     }
 
     Client::~Client() {
@@ -34,6 +58,13 @@ namespace net::client {
 
         mWorkGuard = std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(mIoContext.get_executor());
 
+        {
+            std::lock_guard<std::mutex> lock(mWriteMutex);
+            mOutbox.clear();
+            mWriteInProgress = false;
+            mConnected = false;
+        }
+
         mTransport->connect(host, port, [this](const boost::system::error_code& ec) {
             handleConnectResult(ec);
         });
@@ -60,6 +91,17 @@ namespace net::client {
         }
 
         if (mConnectCallback) mConnectCallback();
+
+        // Requests issued while connecting were held back
+        bool pending;
+        {
+            std::lock_guard<std::mutex> lock(mWriteMutex);
+            mConnected = true;
+            pending = !mOutbox.empty() && !mWriteInProgress;
+            if (pending) mWriteInProgress = true;
+        }
+        if (pending) flush();
+
         readHeader();
     }
 
@@ -81,15 +123,14 @@ namespace net::client {
     }
 
     void Client::requestAsync(const std::string& method, const json& params, ResponseCallback callback) {
-        if (!mIsRunning) return;
-
-        uint32_t id = mNextRequestId.fetch_add(1);
-        {
-            std::lock_guard<std::mutex> lock(mCallbackMutex);
-            mResponseCallbacks[id] = std::move(callback);
-        }
+        Handlers handlers;
+        handlers.onResult = std::move(callback);
+        handlers.errorsAsResult = true;
+        submit(method, params, std::move(handlers), {});
+    }
 
-        writeMessage(Message::makeRequest(id, method, params));
+    void Client::requestAsync(const std::string& method, const json& params, ResponseCallback onResult, RequestErrorCallback onError) {
+        call(method, params, std::move(onResult), std::move(onError));
     }
 
     json Client::request(const std::string& method, const json& params) {
@@ -98,20 +139,266 @@ namespace net::client {
         std::promise<json> promise;
         auto future = promise.get_future();
 
-        requestAsync(method, params, [&promise](const json& result) {
-            promise.set_value(result);
-        });
+        Handlers handlers;
+        handlers.onResult = [&promise](const json& result) { promise.set_value(result); };
+        handlers.onError = [&promise](int, const std::string& message) {
+            promise.set_exception(std::make_exception_ptr(std::runtime_error("Client: " + message)));
+        };
+        handlers.errorsAsResult = true;
+
+        // Backpressure for blocking callers: the slot is taken under the same lock as the wait
+        // that found it free, so another caller cannot grab it in between
+        uint32_t id;
+        bool timed;
+        {
+            std::unique_lock<std::mutex> lock(mSlotMutex);
+            mSlotFreed.wait(lock, [this] { return mInFlight < mPipeline.maxInFlight || !mIsRunning; });
+            if (!mIsRunning) throw std::runtime_error("Client not connected");
+
+            size_t timedBefore = mTimedInFlight;
+            id = acquireSlot(handlers, {});
+            timed = timedBefore == 0 && mTimedInFlight > 0;
+        }
 
+        send(id, method, params, timed);
         return future.get();
     }
 
+    uint32_t Client::call(const std::string& method, const json& params, ResponseCallback onResult,
+                          RequestErrorCallback onError, const CallOptions& options) {
+        Handlers handlers;
+        handlers.onResult = std::move(onResult);
+        handlers.onError = std::move(onError);
+        return submit(method, params, std::move(handlers), options);
+    }
+
+    uint32_t Client::submit(const std::string& method, const json& params, Handlers handlers, const CallOptions& options) {
+        if (!mIsRunning) {
+            fail(std::move(handlers), kErrorClosed, "Client not connected");
+            return 0;
+        }
+
+        uint32_t id;
+        bool timed;
+        {
+            std::lock_guard<std::mutex> lock(mSlotMutex);
+            size_t timedBefore = mTimedInFlight;
+            id = acquireSlot(handlers, options);
+            timed = timedBefore == 0 && mTimedInFlight > 0;
+        }
+
+        if (id == 0) {
+            fail(std::move(handlers), kErrorWindowFull, "Too many requests in flight");
+            return 0;
+        }
+
+        send(id, method, params, timed);
+        return id;
+    }
+
+    void Client::send(uint32_t id, const std::string& method, const json& params, bool startTimer) {
+        // Encoded outside the write lock into a per-thread buffer that keeps its capacity
+        thread_local std::vector<uint8_t> frame;
+        frame.clear();
+        Message::makeRequest(id, method, params).encodeInto(frame, mEncoding);
+        queueFrames(frame);
+
+        if (startTimer) boost::asio::post(mIoContext, [this] { startSweep(); });
+    }
+
+    std::vector<uint32_t> Client::callBatch(std::vector<BatchCall> calls, const CallOptions& options) {
+        std::vector<uint32_t> ids(calls.size(), 0);
+        std::vector<Handlers> handlers(calls.size());
+        for (size_t i = 0; i < calls.size(); ++i) {
+            handlers[i].onResult = std::move(calls[i].callback);
+            handlers[i].onError = std::move(calls[i].onError);
+        }
+
+        if (!mIsRunning) {
+            for (auto& h : handlers) fail(std::move(h), kErrorClosed, "Client not connected");
+            return ids;
+        }
+
+        bool timed = false;
+        {
+            std::lock_guard<std::mutex> lock(mSlotMutex);
+            size_t timedBefore = mTimedInFlight;
+            for (size_t i = 0; i < calls.size(); ++i) ids[i] = acquireSlot(handlers[i], options);
+            timed = timedBefore == 0 && mTimedInFlight > 0;
+        }
+
+        // Encode outside the slot lock, then queue every frame under one write lock
+        thread_local std::vector<uint8_t> frames;
+        frames.clear();
+        for (size_t i = 0; i < calls.size(); ++i) {
+            if (ids[i] == 0) {
+                fail(std::move(handlers[i]), kErrorWindowFull, "Too many requests in flight");
+                continue;
+            }
+            Message::makeRequest(ids[i], calls[i].method, calls[i].params).encodeInto(frames, mEncoding);
+        }
+
+        if (!frames.empty()) queueFrames(frames);
+        if (timed) boost::asio::post(mIoContext, [this] { startSweep(); });
+
+        return ids;
+    }
+
+    uint32_t Client::acquireSlot(Handlers& handlers, const CallOptions& options) {
+        if (mInFlight >= mPipeline.maxInFlight) return 0;
+
+        // Ids keep increasing; skip the ones whose slot is still held by an older request
+        const size_t mask = mSlots.size() - 1;
+        uint32_t id;
+        do {
+            id = mNextRequestId++;
+        } while (id == 0 || mSlots[id & mask].id != 0);
+
+        Slot& slot = mSlots[id & mask];
+        slot.id = id;
+        slot.handlers = std::move(handlers);
+
+        auto timeout = options.timeout.value_or(mPipeline.requestTimeout);
+        if (timeout.count() > 0) {
+            slot.deadline = Clock::now() + timeout;
+            ++mTimedInFlight;
+        }
+
+        ++mInFlight;
+        return id;
+    }
+
+    Client::Handlers Client::releaseSlot(uint32_t id) {
+        Slot& slot = mSlots[id & (mSlots.size() - 1)];
+        if (id == 0 || slot.id != id) return {};
+
+        Handlers handlers = std::move(slot.handlers);
+        slot.handlers = {};
+        slot.id = 0;
+        if (slot.deadline != Clock::time_point::max()) --mTimedInFlight;
+        slot.deadline = Clock::time_point::max();
+
+        --mInFlight;
+        mSlotFreed.notify_one();
+        return handlers;
+    }
+
+    bool Client::cancel(uint32_t id) {
+        Handlers handlers;
+        {
+            std::lock_guard<std::mutex> lock(mSlotMutex);
+            handlers = releaseSlot(id);
+        }
+
+        if (!handlers) return false;
+        fail(std::move(handlers), kErrorCancelled, "Request cancelled");
+        return true;
+    }
+
+    size_t Client::inFlight() const {
+        std::lock_guard<std::mutex> lock(mSlotMutex);
+        return mInFlight;
+    }
+
+    // Local failures go to onError, or to onResult as {code, message} for legacy requestAsync
+    void Client::fail(Handlers handlers, int code, const std::string& message) {
+        RequestErrorCallback onError = std::move(handlers.onError);
+        if (!onError && handlers.errorsAsResult && handlers.onResult) {
+            onError = [onResult = std::move(handlers.onResult)](int code, const std::string& message) {
+                onResult(json{{"code", code}, {"message", message}});
+            };
+        }
+        if (!onError) return;
+
+        // Same thread as regular responses while the io loop is alive
+        if (mIsRunning) {
+            boost::asio::post(mIoContext, [onError = std::move(onError), code, message] { onError(code, message); });
+        } else {
+            onError(code, message);
+        }
+    }
+
+    void Client::failAll(int code, const std::string& message) {
+        std::vector<Handlers> pending;
+        {
+            std::lock_guard<std::mutex> lock(mSlotMutex);
+            for (auto& slot : mSlots) {
+                if (slot.id == 0) continue;
+                if (auto handlers = releaseSlot(slot.id)) pending.push_back(std::move(handlers));
+            }
+        }
+
+        for (auto& handlers : pending) fail(std::move(handlers), code, message);
+    }
+
+    void Client::startSweep() {
+        if (mSweepRunning) return;
+        mSweepRunning = true;
+
+        mSweepTimer.expires_after(kSweepInterval);
+        mSweepTimer.async_wait([this](const boost::system::error_code& ec) {
+            if (ec) return;
+            sweep();
+        });
+    }
+
+    void Client::sweep() {
+        mSweepRunning = false;
+
+        std::vector<Handlers> expired;
+        bool more;
+        {
+            std::lock_guard<std::mutex> lock(mSlotMutex);
+            auto now = Clock::now();
+            for (auto& slot : mSlots) {
+                if (slot.id != 0 && slot.deadline <= now) expired.push_back(releaseSlot(slot.id));
+            }
+            more = mTimedInFlight > 0;
+        }
+
+        for (auto& handlers : expired) {
+            if (handlers.onError) handlers.onError(kErrorTimeout, "Request timed out");
+        }
+
+        if (more && mIsRunning) startSweep();
+    }
+
     void Client::writeMessage(const net::protocol::Message& msg) {
-        auto bytes = std::make_shared<std::vector<uint8_t>>(msg.encode());
+        queueFrames(msg.encode(mEncoding));
+    }
+
+    void Client::queueFrames(const std::vector<uint8_t>& frames) {
+        bool start = false;
+        {
+            std::lock_guard<std::mutex> lock(mWriteMutex);
+            mOutbox.insert(mOutbox.end(), frames.begin(), frames.end());
+            start = mConnected && !mWriteInProgress;
+            if (start) mWriteInProgress = true;
+        }
+
         // Use post to ensure the transport doesn't block the caller
-        boost::asio::post(mIoContext, [this, bytes]() {
-            mTransport->asyncWrite(boost::asio::buffer(*bytes), [this, bytes](auto ec, size_t) { 
-                handleIoError(ec); 
-            });
+        if (start) boost::asio::post(mIoContext, [this] { flush(); });
+    }
+
+    void Client::flush() {
+        {
+            std::lock_guard<std::mutex> lock(mWriteMutex);
+            mWriting.clear();
+            mWriting.swap(mOutbox);
+        }
+
+        // Single outstanding write; whatever queues up meanwhile goes out next
+        mTransport->asyncWrite(boost::asio::buffer(mWriting), [this](auto ec, size_t) {
+            if (handleIoError(ec)) return;
+
+            {
+                std::lock_guard<std::mutex> lock(mWriteMutex);
+                if (mOutbox.empty()) {
+                    mWriteInProgress = false;
+                    return;
+                }
+            }
+            flush();
         });
     }
 
@@ -140,17 +427,14 @@ namespace net::client {
                 if (handleIoError(ec)) return;
 
                 try {
-                    MessageType type = static_cast<MessageType>(mReadBuffer[0]);
-                    
-                    // --- THE FIX: SAFE ITERATOR HANDLING ---
-                    // Create a stack-local copy of the payload bytes.
-                    // This ensures that 'Message::decode' (and the JSON parser) 
-                    // holds iterators to this local vector, NOT the member mReadBuffer.
-                    // If mReadBuffer is resized by the next readHeader cycle, 
-                    // these local iterators remain valid.
-                    std::vector<uint8_t> payload(mReadBuffer.begin() + kHeaderSize, mReadBuffer.end());
+                    MessageType type = Message::typeFromByte(mReadBuffer[0]);
+                    BodyEncoding encoding = Message::encodingFromByte(mReadBuffer[0]);
                     
-                    Message msg = Message::decode(type, payload);
+                    // Parse straight from the receive buffer. decode() finishes before
+                    // the next readHeader() cycle can resize mReadBuffer.
+                    auto payload = std::span<const uint8_t>(mReadBuffer).subspan(kHeaderSize);
+
+                    Message msg = Message::decode(type, payload, encoding);
                     handleMessage(msg);
                     
                 } catch (const std::exception& e) {
@@ -170,23 +454,22 @@ namespace net::client {
     void Client::handleMessage(const Message& msg) {
         if (msg.type == MessageType::Response) {
             uint32_t id = msg.j.value("id", 0);
-            ResponseCallback callback = nullptr;
+            Handlers handlers;
 
             {
-                std::lock_guard<std::mutex> lock(mCallbackMutex);
-                auto it = mResponseCallbacks.find(id);
-                if (it != mResponseCallbacks.end()) {
-                    callback = std::move(it->second);
-                    mResponseCallbacks.erase(it);
-                }
+                std::lock_guard<std::mutex> lock(mSlotMutex);
+                handlers = releaseSlot(id); // empty for cancelled or timed-out requests
             }
 
-            if (callback) {
-                if (msg.j.contains("error")) {
-                    callback(msg.j["error"]);
-                } else {
-                    callback(msg.j.value("result", json::object()));
+            if (msg.j.contains("error")) {
+                const json& error = msg.j["error"];
+                if (handlers.errorsAsResult) {
+                    if (handlers.onResult) handlers.onResult(error);
+                } else if (handlers.onError) {
+                    handlers.onError(error.value("code", 0), error.value("message", std::string()));
                 }
+            } else if (handlers.onResult) {
+                handlers.onResult(msg.j.value("result", json::object()));
             }
         } else if (msg.type == MessageType::Push) {
             if (mPushCallback) {
@@ -218,7 +501,13 @@ namespace net::client {
             mTransport->close();
         }
 
+        mSweepTimer.cancel();
         stopIo();
+        mSweepRunning = false;
+
+        // Nobody will answer these anymore; also wakes request() callers
+        failAll(kErrorClosed, "Connection closed");
+        mSlotFreed.notify_all();
     }
 
 } // namespace net::client
\ No newline at end of file
@@ -3,14 +3,18 @@
 #include <boost/asio.hpp>
 #include <thread>
 #include <mutex>
-#include <unordered_map>
+#include <condition_variable>
+#include <vector>
 #include <functional>
 #include <future>
 #include <atomic>
+#include <chrono>
+#include <optional>
 
 #include "net/core/IClient.h"
 #include "net/protocol/Message.h"
 #include "net/protocol/MessageType.h"
+#include "net/protocol/BodyEncoding.h"
 #include "net/protocol/Json.h"
 #include "net/core/ITransport.h"
 
@@ -20,9 +24,35 @@ namespace net::client {
     public:
         enum class RunMode{ Threaded, Manual};
 
-        explicit Client(boost::asio::io_context& io, std::unique_ptr<ITransport> transport, RunMode mode = RunMode::Threaded);
+        // Codes passed to a RequestErrorCallback when no response arrives
+        static constexpr int kErrorTimeout    = -32003;
+        static constexpr int kErrorWindowFull = -32004;
+        static constexpr int kErrorCancelled  = -32005;
+        static constexpr int kErrorClosed     = -32006;
+
+        struct PipelineOptions {
+            size_t maxInFlight = 256;                   // requests awaiting a response
+            std::chrono::milliseconds requestTimeout{0}; // 0 = wait forever
+        };
+
+        struct CallOptions {
+            std::optional<std::chrono::milliseconds> timeout; // overrides PipelineOptions::requestTimeout
+        };
+
+        struct BatchCall {
+            std::string method;
+            json params;
+            ResponseCallback callback;
+            RequestErrorCallback onError;   // optional
+        };
+
+        explicit Client(boost::asio::io_context& io, std::unique_ptr<ITransport> transport, RunMode mode = RunMode::Threaded,
+                        net::protocol::BodyEncoding encoding = net::protocol::BodyEncoding::Json);
         virtual ~Client();
 
+        // Must be called before connect()
+        void configurePipeline(const PipelineOptions& options);
+
         // IClient
         // Client owns transport connection lifecycle
         bool connect(const std::string& host, uint16_t port) override;
@@ -30,20 +60,57 @@ namespace net::client {
         bool isRunning() const override;
         void poll() override;
 
+        // Fails instead of queueing when the window is full (kErrorWindowFull, to onError only)
         void requestAsync(const std::string& method, const json& params, ResponseCallback cb) override;
+        void requestAsync(const std::string& method, const json& params, ResponseCallback onResult, RequestErrorCallback onError) override;
 
+        // Blocks until it holds a slot, then for the response
         json request(const std::string& method, const json& params = json::object()) override;
 
+        // Pipelined call. Returns the request id, or 0 if the in-flight window is full (onError then gets kErrorWindowFull).
+        // `onResult` only sees results; server errors and local failures go to `onError`, if given.
+        uint32_t call(const std::string& method, const json& params, ResponseCallback onResult,
+                      RequestErrorCallback onError = nullptr, const CallOptions& options = {});
+
+        // Several requests in one write. Ids line up with `calls`; 0 where the window was full.
+        std::vector<uint32_t> callBatch(std::vector<BatchCall> calls, const CallOptions& options = {});
+
+        // Drops a pending request; its onError gets kErrorCancelled and a late response is ignored
+        bool cancel(uint32_t id);
+
+        size_t inFlight() const;
+
         void onConnect(VoidCallback handler) override;
         void onDisconnect(VoidCallback handler) override;
         void onError(ErrorCallback handler) override;
         void onPush(PushHandler handler) override;
 
     private:
+        using Clock = std::chrono::steady_clock;
+
+        // Where the outcome of one request goes
+        struct Handlers {
+            ResponseCallback onResult;
+            RequestErrorCallback onError;
+            bool errorsAsResult = false;    // legacy requestAsync: errors without onError go to onResult as {code, message}
+
+            explicit operator bool() const noexcept { return onResult || onError; }
+        };
+
+        // One pending request. A slot is free while id == 0.
+        struct Slot {
+            uint32_t id = 0;
+            Handlers handlers;
+            Clock::time_point deadline = Clock::time_point::max();
+        };
+
         // IO Networking helpers
         void readHeader();
         void readBody(size_t payloadSize);
         void writeMessage(const net::protocol::Message& message);
+        // Appends encoded frames to the outbox and starts a write if none is running
+        void queueFrames(const std::vector<uint8_t>& frames);
+        void flush();
         void handleMessage(const net::protocol::Message& message);
 
 
@@ -55,6 +122,22 @@ namespace net::client {
         void handleBodyRead(const boost::system::error_code& ec, const std::vector<uint8_t>& payload);
 
         bool handleIoError(const boost::system::error_code& ec);
+
+        uint32_t submit(const std::string& method, const json& params, Handlers handlers, const CallOptions& options);
+        // Encodes a request for a slot that is already held and queues it
+        void send(uint32_t id, const std::string& method, const json& params, bool startTimer);
+
+        // Slot table (callers hold mSlotMutex). acquireSlot only takes the handlers when it succeeds.
+        uint32_t acquireSlot(Handlers& handlers, const CallOptions& options);
+        Handlers releaseSlot(uint32_t id);
+
+        void fail(Handlers handlers, int code, const std::string& message);
+        void failAll(int code, const std::string& message);
+
+        // Timeout sweep, io thread only
+        void startSweep();
+        void sweep();
+
     private:
         // Transport
         std::unique_ptr<ITransport> mTransport;
@@ -63,17 +146,32 @@ namespace net::client {
 
         // State
         RunMode mRunMode;
+        net::protocol::BodyEncoding mEncoding;
         std::atomic<bool> mIsRunning{false};
         std::vector<uint8_t> mReadBuffer;
 
         std::array<uint8_t, net::protocol::kHeaderSize> mHeaderBuf;
 
+        // Outgoing frames: everything queued while a write is outstanding goes out in the next one
+        std::mutex mWriteMutex;
+        std::vector<uint8_t> mOutbox;
+        std::vector<uint8_t> mWriting;      // io thread only
+        bool mWriteInProgress = false;
+        bool mConnected = false;
+
         // Threading & callbacks
         std::thread mThread;
-        mutable std::mutex mCallbackMutex;
-        std::atomic<uint32_t> mNextRequestId{1};
-        std::unordered_map<uint32_t, ResponseCallback> mResponseCallbacks;
-        
+        PipelineOptions mPipeline;
+        mutable std::mutex mSlotMutex;
+        std::condition_variable mSlotFreed;
+        std::vector<Slot> mSlots;           // power-of-two sized, indexed by id & (size - 1)
+        size_t mInFlight = 0;
+        size_t mTimedInFlight = 0;
+        uint32_t mNextRequestId = 1;
+
+        boost::asio::steady_timer mSweepTimer;
+        bool mSweepRunning = false;
+
 
         // Event handlers
         VoidCallback mConnectCallback;
@@ -43,7 +43,9 @@ namespace net::client {
         }
 
 
-        return std::make_unique<net::client::Client>(io, std::move(transport), runMode);
+        auto client = std::make_unique<net::client::Client>(io, std::move(transport), runMode, cfg.encoding);
+        client->configurePipeline({cfg.maxInFlight, cfg.requestTimeout});
+        return client;
     }
 
 } // namespace net::client
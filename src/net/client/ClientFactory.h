@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <cstdint>
+#include <chrono>
 
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
@@ -22,6 +23,13 @@ namespace net::client {
         std::string host;
         uint16_t port = 0;
 
+        // Body format for outgoing frames; the server answers in kind
+        net::protocol::BodyEncoding encoding = net::protocol::BodyEncoding::Json;
+
+        // Request pipelining
+        size_t maxInFlight = 256;
+        std::chrono::milliseconds requestTimeout{0};    // 0 = wait forever
+
         // Optional (future-proofing)
         bool verifyPeer = true;
     };
@@ -15,6 +15,8 @@ namespace net::core {
         using PushHandler = std::function<void(const json& pushBody)>;
         using VoidCallback = std::function<void()>;
         using ErrorCallback = std::function<void(const std::string& errorMsg)>;
+        // Why a request produced no result: a server error response or a local failure
+        using RequestErrorCallback = std::function<void(int code, const std::string& message)>;
 
         virtual ~IClient() = default;
 
@@ -34,10 +36,17 @@ namespace net::core {
 
         // Asynchronous Requests (RPC)
 
-        // Send an async request to `method` and get the result later in the callback passed
+        // Send an async request to `method` and get the result later in the callback passed.
+        // Errors reach `cb` as a {code, message} object: server error responses as sent, local
+        // failures (timeout, full window, cancel, close) with the client's kError* codes.
         virtual void requestAsync(const std::string& method, const json& params, ResponseCallback cb) = 0;
 
-        // Send a synchronous(blocking) request.
+        // Same, with errors kept apart: `onResult` only ever sees results, while server errors
+        // and local failures go to `onError`.
+        virtual void requestAsync(const std::string& method, const json& params, ResponseCallback onResult, RequestErrorCallback onError) = 0;
+
+        // Send a synchronous(blocking) request. Server errors are returned as {code, message};
+        // local failures throw std::runtime_error.
         virtual json request(const std::string& method, const json& params = json::object()) = 0;
 
         // Event Handlers (Subscriptions)
@@ -1,11 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <cstdint>
 #include <functional>
 
 #include "net/protocol/Message.h"
+#include "net/protocol/SharedFrame.h"
 
 namespace net::core {
+
+    // Outgoing queue counters of a session
+    struct SessionStats {
+        size_t queuedFrames = 0;   // frames waiting or being written
+        size_t bytesPending = 0;   // bytes not yet handed to the socket
+        uint64_t framesSent = 0;
+        uint64_t bytesSent = 0;
+    };
+
     class ISession;
     class ISession : public std::enable_shared_from_this<ISession> {
     public:
@@ -23,11 +34,17 @@ namespace net::core {
         virtual void onClose(const SessionCallback& handler) = 0;
         
         virtual void send(const net::protocol::Message& message) = 0;
+        virtual void send(const net::protocol::SharedFrame& frame) = 0; // pre-encoded, shared across sessions
         virtual void onMessage(const MessageCallback& handler) = 0;
 
         virtual void onError(const ErrorCallback& handler) = 0;
         
         virtual void setUid(uint32_t uid) = 0;
         virtual uint32_t getUid() const = 0;
+
+        // Body encoding this peer speaks (learned from its last inbound frame)
+        virtual net::protocol::BodyEncoding getEncoding() const = 0;
+
+        virtual SessionStats stats() const = 0;
     };
 }
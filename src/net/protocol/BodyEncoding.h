@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace net::protocol {
+
+// Serialization format of the frame body.
+// Carried in the high nibble of the header type byte, so frames from peers
+// that only know about JSON (high nibble = 0) are still understood.
+enum class BodyEncoding : uint8_t {
+    Json        = 0,   // Compact JSON text (fallback, always supported)
+    MessagePack = 1,   // MessagePack binary
+    Cbor        = 2    // CBOR (RFC 8949) binary
+};
+
+constexpr size_t kBodyEncodingCount = 3;
+
+} // namespace net::protocol
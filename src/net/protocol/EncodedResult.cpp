@@ -0,0 +1,39 @@
+#include "net/protocol/EncodedResult.h"
+
+#include <stdexcept>
+
+namespace net::protocol {
+
+EncodedResult::EncodedResult(json value)
+    : mValue(std::move(value)) {}
+
+const json& EncodedResult::value() const noexcept {
+    return mValue;
+}
+
+std::span<const uint8_t> EncodedResult::bytes(BodyEncoding encoding) const {
+    size_t index = static_cast<size_t>(encoding);
+    if (index >= kBodyEncodingCount) {
+        throw std::invalid_argument("Unsupported body encoding");
+    }
+
+    std::call_once(mOnce[index], [&] {
+        switch (encoding) {
+            case BodyEncoding::Json: {
+                std::string body = mValue.dump();
+                mBytes[index].assign(body.begin(), body.end());
+                break;
+            }
+            case BodyEncoding::MessagePack:
+                json::to_msgpack(mValue, mBytes[index]);
+                break;
+            case BodyEncoding::Cbor:
+                json::to_cbor(mValue, mBytes[index]);
+                break;
+        }
+    });
+
+    return mBytes[index];
+}
+
+} // namespace net::protocol
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <span>
+#include <vector>
+#include <cstdint>
+
+#include "net/protocol/Message.h"
+#include "net/protocol/BodyEncoding.h"
+
+namespace net::protocol {
+
+    // A response result that is serialized at most once per body encoding.
+    // Message::encodeResponse splices the cached bytes into each response frame, so a result
+    // shared by many requests (e.g. the roster for one version) is never re-encoded per request.
+    class EncodedResult {
+    public:
+        explicit EncodedResult(json value);
+
+        const json& value() const noexcept;
+
+        // Encoded body of value(); built on first use, safe to call from several threads
+        std::span<const uint8_t> bytes(BodyEncoding encoding) const;
+
+    private:
+        json mValue;
+        mutable std::array<std::once_flag, kBodyEncodingCount> mOnce;
+        mutable std::array<std::vector<uint8_t>, kBodyEncodingCount> mBytes;
+    };
+
+} // namespace net::protocol
@@ -1,4 +1,6 @@
 #include "net/protocol/Message.h"
+#include "net/protocol/EncodedResult.h"
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <stdexcept>
@@ -20,50 +22,136 @@ uint64_t Message::nowTimestamp() {
 }
 
 
-// Encoding: [1 byte type][4 bytes length BE][JSON pretty body]
-std::vector<uint8_t> Message::encode() const {
-    // Pretty-print JSON
-    std::string body = j.dump(4);
+// Encoding: [1 byte type|encoding][4 bytes length BE][body]
+std::vector<uint8_t> Message::encode(BodyEncoding encoding) const {
+    std::vector<uint8_t> out;
+    encodeInto(out, encoding);
+    return out;
+}
 
-    uint32_t len = static_cast<uint32_t>(body.size());
-    uint32_t lenBE =
-        ((len & 0x000000FFu) << 24) |
-        ((len & 0x0000FF00u) << 8)  |
-        ((len & 0x00FF0000u) >> 8)  |
-        ((len & 0xFF000000u) >> 24);
+void Message::encodeInto(std::vector<uint8_t>& out, BodyEncoding encoding) const {
+    const size_t start = out.size();
+    out.resize(start + kHeaderSize);
+
+    switch (encoding) {
+        case BodyEncoding::Json: {
+            std::string body = j.dump();
+            out.insert(out.end(), body.begin(), body.end());
+            break;
+        }
+        case BodyEncoding::MessagePack:
+            json::to_msgpack(j, out); // appends after the header
+            break;
+        case BodyEncoding::Cbor:
+            json::to_cbor(j, out);
+            break;
+        default:
+            out.resize(start);
+            throw std::invalid_argument("Unsupported body encoding");
+    }
 
-    std::vector<uint8_t> out;
-    out.reserve(1 + 4 + len);
+    uint32_t len = static_cast<uint32_t>(out.size() - start - kHeaderSize);
 
-    // MessageType
-    out.push_back(static_cast<uint8_t>(type));
+    // MessageType + BodyEncoding
+    out[start] = makeTypeByte(type, encoding);
 
     // Length (big-endian)
-    uint8_t* p = reinterpret_cast<uint8_t*>(&lenBE);
-    out.insert(out.end(), p, p + 4);
+    out[start + 1] = static_cast<uint8_t>(len >> 24);
+    out[start + 2] = static_cast<uint8_t>(len >> 16);
+    out[start + 3] = static_cast<uint8_t>(len >> 8);
+    out[start + 4] = static_cast<uint8_t>(len);
+}
+
+
+// Encode the response with a null result, then swap the null for the cached result bytes
+std::vector<uint8_t> Message::encodeResponse(uint32_t id, const EncodedResult& result, BodyEncoding encoding) {
+    std::vector<uint8_t> skeleton = makeResponse(id, nullptr).encode(encoding);
+
+    // "result" key followed by its null value, per encoding
+    static const std::string kJsonNull = "\"result\":null";
+    static const std::vector<uint8_t> kMsgpackNull = { 0xa6, 'r', 'e', 's', 'u', 'l', 't', 0xc0 };
+    static const std::vector<uint8_t> kCborNull    = { 0x66, 'r', 'e', 's', 'u', 'l', 't', 0xf6 };
+
+    std::span<const uint8_t> placeholder;
+    size_t nullSize = 1;
+    switch (encoding) {
+        case BodyEncoding::Json:
+            placeholder = { reinterpret_cast<const uint8_t*>(kJsonNull.data()), kJsonNull.size() };
+            nullSize = 4;
+            break;
+        case BodyEncoding::MessagePack: placeholder = kMsgpackNull; break;
+        case BodyEncoding::Cbor:        placeholder = kCborNull; break;
+        default:
+            throw std::invalid_argument("Unsupported body encoding");
+    }
+
+    auto at = std::search(skeleton.begin() + kHeaderSize, skeleton.end(), placeholder.begin(), placeholder.end());
+    if (at == skeleton.end()) {
+        throw std::logic_error("Response skeleton has no result placeholder");
+    }
+    auto nullAt = at + (placeholder.size() - nullSize);
 
-    // JSON payload
+    std::span<const uint8_t> body = result.bytes(encoding);
+
+    std::vector<uint8_t> out;
+    out.reserve(skeleton.size() - nullSize + body.size());
+    out.insert(out.end(), skeleton.begin(), nullAt);
     out.insert(out.end(), body.begin(), body.end());
+    out.insert(out.end(), nullAt + nullSize, skeleton.end());
+
+    uint32_t len = static_cast<uint32_t>(out.size() - kHeaderSize);
+    out[1] = static_cast<uint8_t>(len >> 24);
+    out[2] = static_cast<uint8_t>(len >> 16);
+    out[3] = static_cast<uint8_t>(len >> 8);
+    out[4] = static_cast<uint8_t>(len);
 
     return out;
 }
 
 
-// Decode a message from its JSON payload
-// Type is already known from the header
+// Decode a message from its body payload
+// Type and encoding are already known from the header
 
-Message Message::decode(MessageType type, const std::vector<uint8_t>& payload) {
+Message Message::decode(MessageType type, std::span<const uint8_t> payload, BodyEncoding encoding) {
     if (payload.empty()) {
-        throw std::runtime_error("Empty JSON payload");
+        throw std::runtime_error("Empty message payload");
     }
 
-    std::string body(payload.begin(), payload.end());
-    json parsed = json::parse(body);
+    json parsed;
+    switch (encoding) {
+        case BodyEncoding::Json:
+            parsed = json::parse(payload.begin(), payload.end());
+            break;
+        case BodyEncoding::MessagePack:
+            parsed = json::from_msgpack(payload.begin(), payload.end());
+            break;
+        case BodyEncoding::Cbor:
+            parsed = json::from_cbor(payload.begin(), payload.end());
+            break;
+        default:
+            throw std::runtime_error("Unsupported body encoding");
+    }
 
     return Message(type, parsed);
 }
 
 
+uint8_t Message::makeTypeByte(MessageType type, BodyEncoding encoding) {
+    return static_cast<uint8_t>(
+        (static_cast<uint8_t>(encoding) << kEncodingShift) |
+        (static_cast<uint8_t>(type) & kMessageTypeMask)
+    );
+}
+
+MessageType Message::typeFromByte(uint8_t typeByte) {
+    return static_cast<MessageType>(typeByte & kMessageTypeMask);
+}
+
+BodyEncoding Message::encodingFromByte(uint8_t typeByte) {
+    return static_cast<BodyEncoding>(typeByte >> kEncodingShift);
+}
+
+
 // Convenience Builders
 
 Message Message::makeRequest(uint32_t id, const std::string& method, const json& params) {
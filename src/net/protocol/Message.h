@@ -2,17 +2,25 @@
 
 #include <string>
 #include <vector>
+#include <span>
 #include <cstdint>
 #include <nlohmann/json.hpp>
 #include "net/protocol/MessageType.h"
+#include "net/protocol/BodyEncoding.h"
 
 namespace net::protocol {
     constexpr size_t kTypeFieldSize = sizeof(MessageType); // 1 byte
     constexpr size_t kLengthFieldSize = sizeof(uint32_t);  // 4 bytes
     constexpr size_t kHeaderSize = kTypeFieldSize + kLengthFieldSize; // 5 bytes
+
+    // Type byte layout: [4 bits BodyEncoding][4 bits MessageType]
+    constexpr uint8_t kMessageTypeMask = 0x0F;
+    constexpr uint8_t kEncodingShift = 4;
     
     using json = nlohmann::json;
 
+    class EncodedResult;
+
     class Message {
     public:
         MessageType type;
@@ -22,10 +30,18 @@ namespace net::protocol {
         Message(MessageType t, const json& body);
 
         // Serialization (to bytes)
-        std::vector<uint8_t> encode() const;
+        std::vector<uint8_t> encode(BodyEncoding encoding = BodyEncoding::Json) const;
+        // Appends the encoded frame to `out`, so callers can reuse one buffer across frames
+        void encodeInto(std::vector<uint8_t>& out, BodyEncoding encoding = BodyEncoding::Json) const;
 
         // Deserialization (from bytes)
-        static Message decode(MessageType type, const std::vector<uint8_t>& payload);
+        // Parses straight from `payload`, which only has to stay valid for the duration of the call
+        static Message decode(MessageType type, std::span<const uint8_t> payload, BodyEncoding encoding = BodyEncoding::Json);
+
+        // Header type byte helpers
+        static uint8_t makeTypeByte(MessageType type, BodyEncoding encoding);
+        static MessageType typeFromByte(uint8_t typeByte);
+        static BodyEncoding encodingFromByte(uint8_t typeByte);
 
         // Convenience wrappers
         static Message makeRequest(uint32_t id, const std::string& method, const json& params);
@@ -33,6 +49,10 @@ namespace net::protocol {
         static Message makeError(uint32_t id, int code, const std::string& msg);
         static Message makePush(const json& pushBody);
 
+        // Encoded response frame carrying a pre-serialized result; same bytes as
+        // makeResponse(id, result.value()).encode(encoding) without re-encoding the result
+        static std::vector<uint8_t> encodeResponse(uint32_t id, const EncodedResult& result, BodyEncoding encoding = BodyEncoding::Json);
+
         // Timestamp helper
         static uint64_t nowTimestamp();
     };
@@ -0,0 +1,31 @@
+#include "net/protocol/SharedFrame.h"
+
+namespace net::protocol {
+
+SharedFrame::SharedFrame(const Message& message, BodyEncoding encoding)
+    : mBytes(std::make_shared<const std::vector<uint8_t>>(message.encode(encoding))) {}
+
+SharedFrame::SharedFrame(std::vector<uint8_t> bytes)
+    : mBytes(std::make_shared<const std::vector<uint8_t>>(std::move(bytes))) {}
+
+const uint8_t* SharedFrame::data() const noexcept {
+    return mBytes ? mBytes->data() : nullptr;
+}
+
+size_t SharedFrame::size() const noexcept {
+    return mBytes ? mBytes->size() : 0;
+}
+
+bool SharedFrame::empty() const noexcept {
+    return size() == 0;
+}
+
+std::span<const uint8_t> SharedFrame::bytes() const noexcept {
+    return { data(), size() };
+}
+
+BodyEncoding SharedFrame::encoding() const noexcept {
+    return empty() ? BodyEncoding::Json : Message::encodingFromByte((*mBytes)[0]);
+}
+
+} // namespace net::protocol
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <span>
+#include <cstdint>
+
+#include "net/protocol/Message.h"
+#include "net/protocol/BodyEncoding.h"
+
+namespace net::protocol {
+
+    // An encoded frame (header + body) that is immutable once built.
+    // Copies share the same bytes, so one serialization can be handed to any number of sessions.
+    class SharedFrame {
+    public:
+        SharedFrame() = default;
+        SharedFrame(const Message& message, BodyEncoding encoding);
+
+        // Takes ownership of an already encoded frame
+        explicit SharedFrame(std::vector<uint8_t> bytes);
+
+        const uint8_t* data() const noexcept;
+        size_t size() const noexcept;
+        bool empty() const noexcept;
+
+        std::span<const uint8_t> bytes() const noexcept;
+        BodyEncoding encoding() const noexcept;
+
+    private:
+        std::shared_ptr<const std::vector<uint8_t>> mBytes;
+    };
+
+} // namespace net::protocol
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace net::server {
+
+    // Atomically published, immutable snapshot. Readers load the current version and keep it
+    // alive for as long as they hold the pointer; writers build a new version and store it.
+    template <typename T>
+    class AtomicSnapshot {
+    public:
+        AtomicSnapshot() : mPtr(std::make_shared<const T>()) {}
+
+        std::shared_ptr<const T> load() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+            return mPtr.load(std::memory_order_acquire);
+#else
+            return std::atomic_load_explicit(&mPtr, std::memory_order_acquire);
+#endif
+        }
+
+        void store(std::shared_ptr<const T> next) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+            mPtr.store(std::move(next), std::memory_order_release);
+#else
+            std::atomic_store_explicit(&mPtr, std::move(next), std::memory_order_release);
+#endif
+        }
+
+    private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+        std::atomic<std::shared_ptr<const T>> mPtr;
+#else
+        std::shared_ptr<const T> mPtr;
+#endif
+    };
+
+} // namespace net::server
@@ -0,0 +1,68 @@
+#include "net/server/IoContextPool.h"
+
+namespace net::server {
+
+IoContextPool::IoContextPool(size_t threads, ThreadingModel model)
+    : mModel(model)
+    , mThreadCount(threads == 0 ? 1 : threads)
+{
+    size_t contexts = (mModel == ThreadingModel::ContextPerThread) ? mThreadCount : 1;
+
+    for (size_t i = 0; i < contexts; ++i) {
+        // A context run by a single thread can skip internal locking
+        int concurrencyHint = (mModel == ThreadingModel::ContextPerThread) ? 1 : static_cast<int>(mThreadCount);
+        mContexts.push_back(std::make_unique<boost::asio::io_context>(concurrencyHint));
+        mWork.emplace_back(mContexts.back()->get_executor());
+    }
+}
+
+IoContextPool::~IoContextPool() {
+    stop();
+}
+
+boost::asio::io_context& IoContextPool::acceptorContext() {
+    return *mContexts.front();
+}
+
+std::vector<std::reference_wrapper<boost::asio::io_context>> IoContextPool::acceptorContexts() {
+    std::vector<std::reference_wrapper<boost::asio::io_context>> contexts;
+    for (size_t i = 0; i < mThreadCount; ++i) {
+        contexts.push_back(*mContexts[i % mContexts.size()]);
+    }
+    return contexts;
+}
+
+boost::asio::any_io_executor IoContextPool::nextSessionExecutor() {
+    if (mModel == ThreadingModel::SharedContext) {
+        if (mThreadCount == 1) return mContexts.front()->get_executor();
+        return boost::asio::make_strand(*mContexts.front());
+    }
+
+    size_t index = mNext.fetch_add(1, std::memory_order_relaxed) % mContexts.size();
+    return mContexts[index]->get_executor();
+}
+
+size_t IoContextPool::size() const noexcept {
+    return mThreadCount;
+}
+
+void IoContextPool::run() {
+    for (size_t i = 0; i < mThreadCount; ++i) {
+        auto& io = *mContexts[i % mContexts.size()];
+        mThreads.emplace_back([&io] {
+            io.run();
+        });
+    }
+}
+
+void IoContextPool::stop() {
+    mWork.clear();
+    for (auto& io : mContexts) io->stop();
+
+    for (auto& thread : mThreads) {
+        if (thread.joinable()) thread.join();
+    }
+    mThreads.clear();
+}
+
+} // namespace net::server
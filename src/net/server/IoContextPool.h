@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+#include <boost/asio.hpp>
+
+#include "net/server/ServerConfig.h"
+
+namespace net::server {
+
+    // Worker threads and io_contexts backing one server instance.
+    //  - SharedContext:    all threads run one io_context; sessions get their own strand.
+    //  - ContextPerThread: one io_context per thread; sessions are spread round-robin.
+    class IoContextPool {
+    public:
+        IoContextPool(size_t threads, ThreadingModel model);
+        ~IoContextPool();
+
+        IoContextPool(const IoContextPool&) = delete;
+        IoContextPool& operator=(const IoContextPool&) = delete;
+
+        // Context the acceptor lives on
+        boost::asio::io_context& acceptorContext();
+
+        // One context per worker thread for SO_REUSEPORT acceptors (repeats the shared one for SharedContext)
+        std::vector<std::reference_wrapper<boost::asio::io_context>> acceptorContexts();
+
+        // Executor for the next accepted socket. All of a session's handlers run on it serially.
+        boost::asio::any_io_executor nextSessionExecutor();
+
+        size_t size() const noexcept;
+
+        void run();
+        void stop();
+
+    private:
+        using WorkGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
+
+        ThreadingModel mModel;
+        size_t mThreadCount;
+        std::vector<std::unique_ptr<boost::asio::io_context>> mContexts;
+        std::vector<WorkGuard> mWork;
+        std::vector<std::thread> mThreads;
+        std::atomic<size_t> mNext{0};
+    };
+
+} // namespace net::server
@@ -0,0 +1,81 @@
+#include "net/server/Roster.h"
+
+using net::protocol::json;
+using net::protocol::EncodedResult;
+
+namespace net::server {
+
+void Roster::upsert(uint32_t uid, const std::string& name) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMembers[uid] = name;
+    record(uid, name);
+}
+
+void Roster::erase(uint32_t uid) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mMembers.erase(uid) == 0) return;
+    record(uid, std::nullopt);
+}
+
+void Roster::record(uint32_t uid, std::optional<std::string> name) {
+    mChanges.push_back({++mVersion, uid, std::move(name)});
+    if (mChanges.size() > kMaxChanges) mChanges.pop_front();
+}
+
+uint64_t Roster::version() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mVersion;
+}
+
+std::shared_ptr<const Roster::Snapshot> Roster::snapshot() const {
+    auto current = mSnapshot.load();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (current->list && current->version == mVersion) return current;
+
+    // Another reader may have rebuilt it while we waited for the lock
+    current = mSnapshot.load();
+    if (current->list && current->version == mVersion) return current;
+
+    json clients = json::array();
+    for (const auto& [uid, name] : mMembers) {
+        clients.push_back({{"uid", uid}, {"name", name}});
+    }
+
+    auto next = std::make_shared<Snapshot>();
+    next->version = mVersion;
+    next->list = std::make_shared<const EncodedResult>(json{{"version", mVersion}, {"clients", std::move(clients)}});
+
+    mSnapshot.store(next);
+    return next;
+}
+
+std::shared_ptr<const EncodedResult> Roster::list(std::optional<uint64_t> since) const {
+    if (since) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Deltas need every change after `since` still in the log
+        uint64_t oldest = mChanges.empty() ? mVersion + 1 : mChanges.front().version;
+        if (*since <= mVersion && *since + 1 >= oldest) {
+            // Only the latest change per uid matters
+            std::map<uint32_t, const Change*> latest;
+            for (auto it = mChanges.rbegin(); it != mChanges.rend() && it->version > *since; ++it) {
+                latest.emplace(it->uid, &*it);
+            }
+
+            json joined = json::array();
+            json left = json::array();
+            for (const auto& [uid, change] : latest) {
+                if (change->name) joined.push_back({{"uid", uid}, {"name", *change->name}});
+                else              left.push_back(uid);
+            }
+
+            return std::make_shared<const EncodedResult>(
+                json{{"version", mVersion}, {"since", *since}, {"joined", joined}, {"left", left}});
+        }
+    }
+
+    return snapshot()->list;
+}
+
+} // namespace net::server
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "net/protocol/EncodedResult.h"
+#include "net/server/AtomicSnapshot.h"
+
+namespace net::server {
+
+    // Versioned list of connected users (uid -> name) for client_list.
+    // Every join, leave or rename bumps the version. The full list is built and encoded once per
+    // version and shared by all readers; recent changes are kept so clients can ask for a delta instead.
+    class Roster {
+    public:
+        static constexpr size_t kMaxChanges = 1024;
+
+        struct Snapshot {
+            uint64_t version = 0;
+            // {version, clients: [{uid, name}, ...]}; null until the first snapshot() call
+            std::shared_ptr<const net::protocol::EncodedResult> list;
+        };
+
+        void upsert(uint32_t uid, const std::string& name);
+        void erase(uint32_t uid);
+
+        uint64_t version() const;
+
+        // Full list for the current version
+        std::shared_ptr<const Snapshot> snapshot() const;
+
+        // client_list result: the cached {version, clients} for a full list,
+        // a fresh {version, since, joined, left} when `since` is recent enough for a delta
+        std::shared_ptr<const net::protocol::EncodedResult> list(std::optional<uint64_t> since = std::nullopt) const;
+
+    private:
+        struct Change {
+            uint64_t version;
+            uint32_t uid;
+            std::optional<std::string> name;    // empty = left
+        };
+
+        void record(uint32_t uid, std::optional<std::string> name);
+
+        mutable std::mutex mMutex;
+        uint64_t mVersion = 0;
+        std::map<uint32_t, std::string> mMembers;
+        std::deque<Change> mChanges;
+
+        mutable AtomicSnapshot<Snapshot> mSnapshot;
+    };
+
+} // namespace net::server
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <stdexcept>
 
 #include "net/server/Router.h"
 #include "net/protocol/MessageType.h"
@@ -6,6 +7,8 @@
 
 using net::protocol::json;
 using net::protocol::Message;
+using net::protocol::EncodedResult;
+using net::protocol::SharedFrame;
 
 namespace net::server {
 
@@ -22,8 +25,31 @@ namespace net::server {
         mHandlers[method] = std::move(handler);
     }
 
+    void Router::addEncoded(const std::string& method, EncodedHandler handler) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mHandlers[method] = std::move(handler);
+    }
+
     
     net::protocol::Message Router::handle(const net::protocol::Message& request, uint32_t uid){
+        std::shared_ptr<const EncodedResult> encoded;
+        Message response = dispatch(request, uid, encoded);
+        if (encoded) {
+            return Message::makeResponse(request.j.value("id", 0), encoded->value());
+        }
+        return response;
+    }
+
+    SharedFrame Router::respond(const Message& request, uint32_t uid, net::protocol::BodyEncoding encoding) {
+        std::shared_ptr<const EncodedResult> encoded;
+        Message response = dispatch(request, uid, encoded);
+        if (encoded) {
+            return SharedFrame(Message::encodeResponse(request.j.value("id", 0), *encoded, encoding));
+        }
+        return SharedFrame(response, encoding);
+    }
+
+    Message Router::dispatch(const Message& request, uint32_t uid, std::shared_ptr<const EncodedResult>& encoded) {
         uint32_t id = request.j.value("id", 0);
         
         if (request.type != net::protocol::MessageType::Request) {
@@ -36,7 +62,7 @@ namespace net::server {
         }
 
         json params = request.j.value("params", json::object());
-        Handler handler;
+        AnyHandler handler;
 
         {
             std::lock_guard<std::mutex> lock(mMutex);
@@ -49,7 +75,13 @@ namespace net::server {
         }
 
         try {
-            json result = handler(params, uid);
+            if (auto* shared = std::get_if<EncodedHandler>(&handler)) {
+                auto result = (*shared)(params, uid);
+                if (!result) throw std::runtime_error("Handler returned no result");
+                encoded = std::move(result);
+                return Message();
+            }
+            json result = std::get<Handler>(handler)(params, uid);
             return net::protocol::Message::makeResponse(id, result);
         } 
         catch (const json::exception& e) {
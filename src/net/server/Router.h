@@ -2,9 +2,13 @@
 
 #include <string>
 #include <functional>
+#include <memory>
 #include <unordered_map>
+#include <variant>
 #include "net/protocol/Json.h"
 #include "net/protocol/Message.h"
+#include "net/protocol/EncodedResult.h"
+#include "net/protocol/SharedFrame.h"
 #include <mutex>
 
 namespace net::server {
@@ -12,20 +16,33 @@ namespace net::server {
 class Router {
 public:
     using Handler = std::function<net::protocol::json(const net::protocol::json& params, uint32_t uid)>;
+    // For results shared across requests: the handler hands out a result that is encoded once
+    using EncodedHandler = std::function<std::shared_ptr<const net::protocol::EncodedResult>(const net::protocol::json& params, uint32_t uid)>;
     using ErrorHandler = std::function<net::protocol::Message(const net::protocol::Message& request, int code, const std::string& message)>;
 
     Router();
 
     void add(const std::string& method, Handler handler);
+    void addEncoded(const std::string& method, EncodedHandler handler);
 
     net::protocol::Message handle(const net::protocol::Message& request, uint32_t uid);
 
+    // Same as handle(), encoded for the wire. Results from EncodedHandlers are spliced in
+    // from their cached bytes instead of going through json again.
+    net::protocol::SharedFrame respond(const net::protocol::Message& request, uint32_t uid, net::protocol::BodyEncoding encoding);
+
     void setFallback(const ErrorHandler& handler);
 
     bool exists(const std::string& method) const;
 
 private:
-    std::unordered_map<std::string, Handler> mHandlers;
+    using AnyHandler = std::variant<Handler, EncodedHandler>;
+
+    // Runs the request; an EncodedHandler's result goes to `encoded` and the returned message is unused
+    net::protocol::Message dispatch(const net::protocol::Message& request, uint32_t uid,
+                                    std::shared_ptr<const net::protocol::EncodedResult>& encoded);
+
+    std::unordered_map<std::string, AnyHandler> mHandlers;
     mutable std::mutex mMutex;
     ErrorHandler mFallbackHandler;
 };
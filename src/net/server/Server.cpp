@@ -1,34 +1,146 @@
 #include "net/server/Server.h"
 #include <iostream>
+#include <stdexcept>
 
 using boost::asio::ip::tcp;
 using net::protocol::json;
 
 namespace net::server {
 
-Server::Server(boost::asio::io_context& io, unsigned short port): mIo(io),mAcceptor(io, tcp::endpoint(tcp::v4(), port)) {
+namespace {
+#ifdef SO_REUSEPORT
+    using reuse_port = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+    std::unique_ptr<tcp::acceptor> openAcceptor(boost::asio::io_context& io, const Server::ListenOptions& options, unsigned short port) {
+        auto acceptor = std::make_unique<tcp::acceptor>(io);
+
+        tcp::endpoint endpoint = (options.family == AddressFamily::V4)
+            ? tcp::endpoint(tcp::v4(), port)
+            : tcp::endpoint(tcp::v6(), port);
+
+        acceptor->open(endpoint.protocol());
+        acceptor->set_option(tcp::acceptor::reuse_address(true));
+
+        if (options.family != AddressFamily::V4) {
+            // Dual-stack also takes IPv4 clients as v4-mapped addresses
+            acceptor->set_option(boost::asio::ip::v6_only(options.family == AddressFamily::V6Only));
+        }
+
+        if (options.reusePort) {
+#ifdef SO_REUSEPORT
+            acceptor->set_option(reuse_port(true));
+#else
+            throw std::runtime_error("SO_REUSEPORT is not supported on this platform");
+#endif
+        }
+
+        acceptor->bind(endpoint);
+        acceptor->non_blocking(true);      // lets accept() drain the queue without blocking
+        acceptor->listen(options.backlog > 0 ? options.backlog : boost::asio::socket_base::max_listen_connections);
+        return acceptor;
+    }
+}
+
+Server::Server(boost::asio::io_context& io, unsigned short port)
+    : Server(ContextList{std::ref(io)}, ListenOptions{port}) {
 
 }
 
+Server::Server(const ContextList& contexts, const ListenOptions& options) {
+    if (contexts.empty())
+        throw std::invalid_argument("Server needs at least one io_context");
+
+    size_t count = options.reusePort ? contexts.size() : 1;
+
+    // The first bind resolves port 0, the rest of the group joins that port
+    unsigned short bound = options.port;
+    for (size_t i = 0; i < count; ++i) {
+        auto acceptor = openAcceptor(contexts[i], options, bound);
+        bound = acceptor->local_endpoint().port();
+
+        auto executor = acceptor->get_executor();
+        mListeners.push_back(std::make_unique<Listener>(Listener{std::move(acceptor), boost::asio::steady_timer(executor)}));
+    }
+}
+
 void Server::start() {
-    if(mStartCallback) mStartCallback(mAcceptor.local_endpoint().port());
-    accept();
+    if(mStartCallback) mStartCallback(port());
+    for (auto& listener : mListeners) accept(*listener);
 }
 
 void Server::stop() {
     boost::system::error_code ec;
-    mAcceptor.close(ec);
+    for (auto& listener : mListeners) {
+        listener->retry.cancel();
+        listener->acceptor->close(ec);
+    }
     if(mStopCallback) mStopCallback(ec.message());
 }
 
-void Server::accept() {
-    mAcceptor.async_accept([this](auto ec, tcp::socket sock) {
-        if(!ec){
-            mConnectCallback(std::move(sock));
-            accept(); // continue accepting new clients
-        }else if(ec != boost::asio::error::operation_aborted){
-            mErrorCallback(ec.message());
-        }            
+unsigned short Server::port() const {
+    return mListeners.front()->acceptor->local_endpoint().port();
+}
+
+AcceptStats Server::stats() const {
+    AcceptStats stats;
+    stats.accepted = mAccepted.load(std::memory_order_relaxed);
+    stats.acceptErrors = mAcceptErrors.load(std::memory_order_relaxed);
+    stats.wakeups = mWakeups.load(std::memory_order_relaxed);
+    stats.acceptedPerSec = mAcceptRate.perSecond();
+    return stats;
+}
+
+boost::asio::any_io_executor Server::sessionExecutor(Listener& listener) {
+    return mExecutorProvider ? mExecutorProvider() : listener.acceptor->get_executor();
+}
+
+void Server::accept(Listener& listener) {
+    listener.acceptor->async_accept(sessionExecutor(listener), [this, &listener](auto ec, tcp::socket sock) {
+        if(ec == boost::asio::error::operation_aborted || !listener.acceptor->is_open()) return;
+
+        mWakeups.fetch_add(1, std::memory_order_relaxed);
+        if(ec) return acceptFailed(listener, ec);
+
+        accepted(std::move(sock));
+        drain(listener);
+        accept(listener); // continue accepting new clients
+    });
+}
+
+void Server::drain(Listener& listener) {
+    // Connections that queued up meanwhile are taken without another trip through the reactor
+    for (size_t i = 1; i < kMaxAcceptBatch; ++i) {
+        boost::system::error_code ec;
+        tcp::socket sock(sessionExecutor(listener));
+        listener.acceptor->accept(sock, ec);
+
+        if(ec == boost::asio::error::would_block || ec == boost::asio::error::try_again) return;
+        if(ec) {
+            // Let the async accept run into it again and take the backoff path if it persists
+            mAcceptErrors.fetch_add(1, std::memory_order_relaxed);
+            if(mErrorCallback) mErrorCallback(ec.message());
+            return;
+        }
+
+        accepted(std::move(sock));
+    }
+}
+
+void Server::accepted(tcp::socket socket) {
+    mAccepted.fetch_add(1, std::memory_order_relaxed);
+    mAcceptRate.add();
+    mConnectCallback(std::move(socket));
+}
+
+void Server::acceptFailed(Listener& listener, const boost::system::error_code& ec) {
+    mAcceptErrors.fetch_add(1, std::memory_order_relaxed);
+    if(mErrorCallback) mErrorCallback(ec.message());
+
+    // Errors like EMFILE would fire again immediately; give the process a moment to free descriptors
+    listener.retry.expires_after(std::chrono::milliseconds(50));
+    listener.retry.async_wait([this, &listener](const boost::system::error_code& timerEc) {
+        if(!timerEc && listener.acceptor->is_open()) accept(listener);
     });
 }
 
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <functional>
 #include <boost/asio.hpp>
 #include "net/core/IServer.h"
 #include "net/server/Router.h"
+#include "net/server/ServerConfig.h"
+#include "net/server/ServerStats.h"
 #include "net/server/SessionManager.h"
 
 namespace net::server {
@@ -15,12 +18,34 @@ public:
     using ErrorCallback = std::function<void(const std::string&)>;
     using StartCallback = std::function<void(unsigned int)>;
     using StopCallback = std::function<void(const std::string&)>;
+    using ExecutorProvider = std::function<boost::asio::any_io_executor()>;
+    using ContextList = std::vector<std::reference_wrapper<boost::asio::io_context>>;
+
+    struct ListenOptions {
+        unsigned short port = 0;
+        AddressFamily family = AddressFamily::V4;
+        int backlog = 0;            // 0 = system maximum
+        bool reusePort = false;     // one SO_REUSEPORT acceptor per context
+    };
+
+    // Connections taken per accept wakeup (one async completion + non-blocking drain)
+    static constexpr size_t kMaxAcceptBatch = 32;
 
     Server(boost::asio::io_context& io, unsigned short port);
 
+    // Without reusePort only the first context gets an acceptor
+    Server(const ContextList& contexts, const ListenOptions& options);
+
     void start() override;
     void stop() override;
 
+    // Actual bound port (useful when listening on port 0)
+    unsigned short port() const;
+
+    size_t acceptorCount() const noexcept { return mListeners.size(); }
+
+    AcceptStats stats() const;
+
     inline void onConnect(const ConnectCallback& callback) {
         mConnectCallback = callback;
     }
@@ -37,12 +62,31 @@ public:
         mStopCallback = callback;
     }
 
+    // Picks the executor each accepted socket is bound to (defaults to the accepting context)
+    inline void setSessionExecutor(const ExecutorProvider& provider) {
+        mExecutorProvider = provider;
+    }
+
 private:
-    void accept();
+    struct Listener {
+        std::unique_ptr<boost::asio::ip::tcp::acceptor> acceptor;
+        boost::asio::steady_timer retry;    // backoff after errors such as EMFILE
+    };
+
+    void accept(Listener& listener);
+    void drain(Listener& listener);
+    void accepted(boost::asio::ip::tcp::socket socket);
+    void acceptFailed(Listener& listener, const boost::system::error_code& ec);
+    boost::asio::any_io_executor sessionExecutor(Listener& listener);
 
 private:
-    boost::asio::io_context& mIo;
-    boost::asio::ip::tcp::acceptor mAcceptor;
+    std::vector<std::unique_ptr<Listener>> mListeners;
+
+    // Stats
+    std::atomic<uint64_t> mAccepted{0};
+    std::atomic<uint64_t> mAcceptErrors{0};
+    std::atomic<uint64_t> mWakeups{0};
+    RateMeter mAcceptRate;
 
 
     // Callbacks
@@ -50,6 +94,8 @@ private:
     ErrorCallback mErrorCallback; 
     StartCallback mStartCallback;
     StopCallback mStopCallback; 
+
+    ExecutorProvider mExecutorProvider;
 };
 
 } // namespace net::server
@@ -5,6 +5,8 @@ namespace net::server{
     
     bool ServerConfig::isValid() const {
         if (port == 0) return false;
+        if (workerThreads == 0) return false;
+        if (listenBacklog < 0) return false;
         if (mode == ServerMode::Secure)
         return !certFile.empty() && !keyFile.empty();
         return true;
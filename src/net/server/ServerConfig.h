@@ -9,10 +9,30 @@ namespace net::server {
         Secure
     };
 
+    enum class ThreadingModel {
+        SharedContext,      // N threads on one io_context, per-session strands
+        ContextPerThread    // one io_context per thread, round-robin session assignment
+    };
+
+    enum class AddressFamily {
+        V4,
+        V6Only,
+        DualStack           // IPv6 socket that also accepts IPv4-mapped clients
+    };
+
     struct ServerConfig {
         uint16_t port = 0;
         ServerMode mode = ServerMode::Plain;
 
+        // Worker threads running handshakes, crypto and message handling
+        unsigned int workerThreads = 1;
+        ThreadingModel threading = ThreadingModel::SharedContext;
+
+        // Listening socket(s)
+        AddressFamily family = AddressFamily::V4;
+        int listenBacklog = 0;          // 0 = system maximum (SOMAXCONN)
+        bool reusePort = false;         // one SO_REUSEPORT acceptor per worker
+
         // Only used if mode == Secure
         std::string certFile;
         std::string keyFile;
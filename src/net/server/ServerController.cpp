@@ -1,6 +1,7 @@
 #include "net/server/ServerController.h"
 
 #include <iostream>
+#include <chrono>
 
 namespace net::server {
 
@@ -45,21 +46,38 @@ bool ServerController::start(const ServerConfig& cfg) {
         loadTls(cfg.certFile, cfg.keyFile);
     }
     
-    Instance inst;
+    auto instance = std::make_unique<Instance>();
+    auto& inst = *instance;
     inst.cfg = cfg;
-    inst.io = std::make_unique<boost::asio::io_context>();
-    inst.work = std::make_unique<boost::asio::executor_work_guard<
-        boost::asio::io_context::executor_type>>(inst.io->get_executor());
+    inst.pool = std::make_unique<IoContextPool>(cfg.workerThreads, cfg.threading);
+
+    Server::ListenOptions listen;
+    listen.port = cfg.port;
+    listen.family = cfg.family;
+    listen.backlog = cfg.listenBacklog;
+    listen.reusePort = cfg.reusePort;
 
     try {
-        inst.server = std::make_unique<Server>(*inst.io, cfg.port);
+        inst.server = std::make_unique<Server>(inst.pool->acceptorContexts(), listen);
     } catch (const std::exception& e) {
         std::cerr << "Failed to bind port " << cfg.port << ": " << e.what() << "\n";
         return false;
     }
 
+    // With per-thread contexts and SO_REUSEPORT a socket stays on the context that accepted it.
+    // Otherwise it lands on a strand or on the next io_context of the pool.
+    bool keepOnAcceptor = cfg.reusePort && cfg.threading == ThreadingModel::ContextPerThread;
+    if (!keepOnAcceptor) {
+        inst.server->setSessionExecutor([pool = inst.pool.get()] {
+            return pool->nextSessionExecutor();
+        });
+    }
+
     // ---- Connection Factory ----
-    inst.server->onConnect([this, cfg](boost::asio::ip::tcp::socket socket) {
+    inst.server->onConnect([this, cfg, &inst](boost::asio::ip::tcp::socket socket) {
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point acceptedAt = Clock::now();
+
         std::shared_ptr<net::core::ISession> session;
 
         if (cfg.mode == ServerMode::Plain) {
@@ -74,7 +92,20 @@ bool ServerController::start(const ServerConfig& cfg) {
         uint32_t uid = mSessions->add(session);
         session->setUid(uid);
 
-        session->onClose([this, uid](auto) {
+        {
+            std::lock_guard<std::mutex> lock(inst.sessionsMutex);
+            inst.sessions[uid] = session;
+        }
+
+        bool secure = cfg.mode == ServerMode::Secure;
+        auto started = std::make_shared<std::atomic<bool>>(false);
+
+        session->onClose([this, uid, &inst, secure, started](auto) {
+            if (secure && !started->load()) inst.handshakeFailures.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(inst.sessionsMutex);
+                inst.sessions.erase(uid);
+            }
             mSessions->remove(uid);
             mSessions->broadcast(
                 net::protocol::Message::makePush({
@@ -85,19 +116,25 @@ bool ServerController::start(const ServerConfig& cfg) {
         });
 
         session->onMessage([this, uid](const net::protocol::Message& msg, auto s) {
-            auto response = mRouter->handle(msg, uid);
-            s->send(response);
+            s->send(mRouter->respond(msg, uid, s->getEncoding()));
+        });
+
+        // For TLS sessions onStart fires once the handshake is done
+        Clock::time_point startedAt = Clock::now();
+        session->onStart([&inst, secure, started, acceptedAt, startedAt](auto) {
+            auto now = Clock::now();
+            started->store(true);
+            inst.sessionStart.record(now - acceptedAt);
+            if (secure) inst.tlsHandshake.record(now - startedAt);
         });
 
         session->start();
     });
 
     inst.server->start();
-    inst.thread = std::thread([io = inst.io.get()] {
-        io->run();
-    });
+    inst.pool->run();
 
-    mServers.emplace(cfg.port, std::move(inst));
+    mServers.emplace(cfg.port, std::move(instance));
     return true;
 }
 
@@ -106,18 +143,30 @@ void ServerController::stop(uint16_t port) {
     if (it == mServers.end())
         return;
 
-    auto& inst = it->second;
+    auto& inst = *it->second;
 
-    inst.work.reset();
     inst.server->stop();
-    inst.io->stop();
+    inst.pool->stop();
 
-    if (inst.thread.joinable())
-        inst.thread.join();
+    // No handler runs anymore; close what is left before the io_contexts go away
+    closeSessions(inst);
 
     mServers.erase(it);
 }
 
+void ServerController::closeSessions(Instance& inst) {
+    std::vector<std::shared_ptr<net::core::ISession>> live;
+    {
+        std::lock_guard<std::mutex> lock(inst.sessionsMutex);
+        for (auto& [uid, weak] : inst.sessions) {
+            if (auto session = weak.lock()) live.push_back(std::move(session));
+        }
+    }
+
+    // close() fires onClose, which unregisters the session from both maps
+    for (auto& session : live) session->close();
+}
+
 void ServerController::stopAll() {
     auto ports = std::vector<uint16_t>{};
     for (auto& [port, _] : mServers)
@@ -131,4 +180,19 @@ bool ServerController::isRunning(uint16_t port) const {
     return mServers.contains(port);
 }
 
+ServerStats ServerController::stats(uint16_t port) const {
+    ServerStats stats;
+
+    auto it = mServers.find(port);
+    if (it == mServers.end())
+        return stats;
+
+    const auto& inst = *it->second;
+    stats.accept = inst.server->stats();
+    stats.sessionStart = inst.sessionStart.summary();
+    stats.tlsHandshake = inst.tlsHandshake.summary();
+    stats.handshakeFailures = inst.handshakeFailures.load(std::memory_order_relaxed);
+    return stats;
+}
+
 } // namespace net::server
@@ -3,6 +3,8 @@
 #include <unordered_map>
 #include <memory>
 #include <thread>
+#include <mutex>
+#include <atomic>
 #include <cstdint>
 
 #include <boost/asio.hpp>
@@ -14,6 +16,8 @@
 #include "net/server/sessions/PlainSession.h"
 #include "net/server/sessions/SecureSession.h"
 #include "net/server/ServerConfig.h"
+#include "net/server/IoContextPool.h"
+#include "net/server/ServerStats.h"
 
 namespace net::server {
 
@@ -33,21 +37,30 @@ namespace net::server {
 
         bool isRunning(uint16_t port) const;
 
+        // Accept, session start and handshake counters of one listening port (zeros if not running)
+        ServerStats stats(uint16_t port) const;
+
         void loadTls(const std::string& cert, const std::string& key);
 
     private:
         struct Instance {
             ServerConfig cfg;
-            std::unique_ptr<boost::asio::io_context> io;
-            std::unique_ptr<boost::asio::executor_work_guard<
-                boost::asio::io_context::executor_type>> work;
+            std::unique_ptr<IoContextPool> pool;
             std::unique_ptr<Server> server;
-            std::thread thread;
+
+            // Live sessions of this instance; their sockets must not outlive the pool
+            std::mutex sessionsMutex;
+            std::unordered_map<uint32_t, std::weak_ptr<net::core::ISession>> sessions;
+
+            LatencyRecorder sessionStart;
+            LatencyRecorder tlsHandshake;
+            std::atomic<uint64_t> handshakeFailures{0};
         };
 
-        
+        void closeSessions(Instance& inst);
+
     private:
-        std::unordered_map<uint16_t, Instance> mServers;
+        std::unordered_map<uint16_t, std::unique_ptr<Instance>> mServers;
 
         std::shared_ptr<Router> mRouter;
         std::shared_ptr<SessionManager> mSessions;
@@ -0,0 +1,52 @@
+#include "net/server/ServerStats.h"
+
+namespace net::server {
+
+void LatencyRecorder::record(std::chrono::nanoseconds duration) {
+    uint64_t ns = duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0;
+
+    mCount.fetch_add(1, std::memory_order_relaxed);
+    mTotalNs.fetch_add(ns, std::memory_order_relaxed);
+
+    uint64_t max = mMaxNs.load(std::memory_order_relaxed);
+    while (ns > max && !mMaxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+}
+
+LatencySummary LatencyRecorder::summary() const {
+    LatencySummary summary;
+    summary.count = mCount.load(std::memory_order_relaxed);
+    summary.max = std::chrono::nanoseconds(mMaxNs.load(std::memory_order_relaxed));
+    if (summary.count > 0) {
+        summary.average = std::chrono::nanoseconds(mTotalNs.load(std::memory_order_relaxed) / summary.count);
+    }
+    return summary;
+}
+
+int64_t RateMeter::currentSecond() {
+    using namespace std::chrono;
+    return duration_cast<seconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void RateMeter::add(uint64_t events) {
+    int64_t now = currentSecond();
+    int64_t window = mWindow.load(std::memory_order_relaxed);
+
+    // First event of a new second closes the previous window
+    if (now != window && mWindow.compare_exchange_strong(window, now, std::memory_order_relaxed)) {
+        uint64_t closed = mWindowCount.exchange(0, std::memory_order_relaxed);
+        mLastWindowCount.store(now == window + 1 ? closed : 0, std::memory_order_relaxed);
+    }
+
+    mWindowCount.fetch_add(events, std::memory_order_relaxed);
+}
+
+double RateMeter::perSecond() const {
+    int64_t now = currentSecond();
+    int64_t window = mWindow.load(std::memory_order_relaxed);
+
+    if (now == window)     return static_cast<double>(mLastWindowCount.load(std::memory_order_relaxed));
+    if (now == window + 1) return static_cast<double>(mWindowCount.load(std::memory_order_relaxed));
+    return 0.0;
+}
+
+} // namespace net::server
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace net::server {
+
+    struct LatencySummary {
+        uint64_t count = 0;
+        std::chrono::nanoseconds average{0};
+        std::chrono::nanoseconds max{0};
+    };
+
+    struct AcceptStats {
+        uint64_t accepted = 0;
+        uint64_t acceptErrors = 0;
+        uint64_t wakeups = 0;           // accept completions; accepted / wakeups = average batch
+        double acceptedPerSec = 0.0;    // over the last full second
+    };
+
+    struct ServerStats {
+        AcceptStats accept;
+        LatencySummary sessionStart;    // accept -> session started (includes the TLS handshake)
+        LatencySummary tlsHandshake;
+        uint64_t handshakeFailures = 0;
+    };
+
+    // Lock-free count/total/max of durations, safe to record from any thread
+    class LatencyRecorder {
+    public:
+        void record(std::chrono::nanoseconds duration);
+        LatencySummary summary() const;
+
+    private:
+        std::atomic<uint64_t> mCount{0};
+        std::atomic<uint64_t> mTotalNs{0};
+        std::atomic<uint64_t> mMaxNs{0};
+    };
+
+    // Events per second in one-second windows. Concurrent adds at a window edge may land in either window.
+    class RateMeter {
+    public:
+        void add(uint64_t events = 1);
+        double perSecond() const;
+
+    private:
+        static int64_t currentSecond();
+
+        std::atomic<int64_t> mWindow{0};
+        std::atomic<uint64_t> mWindowCount{0};
+        std::atomic<uint64_t> mLastWindowCount{0};
+    };
+
+} // namespace net::server
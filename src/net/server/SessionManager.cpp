@@ -1,97 +1,121 @@
 #include "net/server/SessionManager.h"
+#include <array>
 #include <iostream>
 
 using net::protocol::json;
+using net::protocol::Message;
+using net::protocol::SharedFrame;
+using net::protocol::BodyEncoding;
+
+namespace {
+    // Encodes a message at most once per body encoding, the first time a session needs it
+    class FrameCache {
+    public:
+        explicit FrameCache(const Message& message) : mMessage(message) {}
+
+        const SharedFrame& get(BodyEncoding encoding) {
+            auto& frame = mFrames[static_cast<size_t>(encoding)];
+            if (frame.empty()) frame = SharedFrame(mMessage, encoding);
+            return frame;
+        }
+
+    private:
+        const Message& mMessage;
+        std::array<SharedFrame, net::protocol::kBodyEncodingCount> mFrames;
+    };
+}
 
 namespace net::server {
     
     uint32_t SessionManager::add(const std::shared_ptr<net::core::ISession>& session){
         uint32_t uid = mNextUid.fetch_add(1);
 
-        SessionInfo info;
-        info.session = session;
-        info.startTime = std::chrono::system_clock::now();
+        auto info = std::make_shared<SessionInfo>();
+        info->session = session;
+        info->startTime = std::chrono::system_clock::now();
 
-        std::lock_guard<std::mutex> lock(mMutex);
-        mSessions[uid] = std::move(info);
+        Shard& shard = shardFor(uid);
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
+
+        auto next = std::make_shared<SessionMap>(*shard.sessions.load());
+        mRoster.upsert(uid, info->username);
+        (*next)[uid] = std::move(info);
+        shard.sessions.store(std::move(next));
 
         return uid;
     }
 
 
     void SessionManager::remove(uint32_t uid){
-        std::lock_guard<std::mutex> lock(mMutex);
-
-        auto it = mSessions.find(uid);
-        if(it == mSessions.end())  return;
+        Shard& shard = shardFor(uid);
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
 
-        auto duration = std::chrono::system_clock::now() - it->second.startTime;
-        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration).count();
+        auto current = shard.sessions.load();
+        if(!current->contains(uid))  return;
 
-        mSessions.erase(it);
+        auto next = std::make_shared<SessionMap>(*current);
+        next->erase(uid);
+        shard.sessions.store(std::move(next));
+        mRoster.erase(uid);
     }
 
 
+    std::shared_ptr<const SessionManager::SessionInfo> SessionManager::find(uint32_t uid) const {
+        auto sessions = shardFor(uid).sessions.load();
+        auto it = sessions->find(uid);
+        return it != sessions->end() ? it->second : nullptr;
+    }
+
    
     void SessionManager::broadcast(const net::protocol::Message& message){
-        std::vector<std::shared_ptr<net::core::ISession>> allSessions;
-
-        {
-            std::lock_guard<std::mutex> lock(mMutex);
-            allSessions.reserve(mSessions.size());
-
-            for(auto &sessionInfo: mSessions){
-                allSessions.push_back(sessionInfo.second.session);
+        // Hold each shard's snapshot while sending; writers meanwhile publish new versions
+        FrameCache frames(message);
+        for(auto& shard: mShards){
+            auto sessions = shard.sessions.load();
+            for(auto& [uid, info]: *sessions){
+                info->session->send(frames.get(info->session->getEncoding()));
             }
         }
-
-
-        for(auto& session: allSessions) session->send(message);
-    } 
+    }
 
     void SessionManager::sendTo(const std::vector<uint32_t>& uids, const net::protocol::Message& message) {
-        std::vector<std::shared_ptr<net::core::ISession>> targets;
-
-        {
-            std::lock_guard<std::mutex> lock(mMutex);
-            
-            for (uint32_t uid : uids) {
-                auto it = mSessions.find(uid);
-                if (it != mSessions.end()) {
-                    targets.push_back(it->second.session);
-                }
+        FrameCache frames(message);
+        for (uint32_t uid : uids) {
+            if (auto info = find(uid)) {
+                info->session->send(frames.get(info->session->getEncoding()));
             }
-        } 
-
-        for (auto& session : targets) {
-            session->send(message);
         }
     }
 
     void SessionManager::setName(uint32_t uid, const std::string& name) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto it = mSessions.find(uid);
-        if(it != mSessions.end()){
-            it->second.username = name;
-        }
+        Shard& shard = shardFor(uid);
+        std::lock_guard<std::mutex> lock(shard.writeMutex);
+
+        auto current = shard.sessions.load();
+        auto it = current->find(uid);
+        if(it == current->end()) return;
+
+        // Entries are immutable once published; replace the renamed one
+        auto renamed = std::make_shared<SessionInfo>(*it->second);
+        renamed->username = name;
 
+        auto next = std::make_shared<SessionMap>(*current);
+        (*next)[uid] = std::move(renamed);
+        shard.sessions.store(std::move(next));
+        mRoster.upsert(uid, name);
     }
 
     std::string SessionManager::getName(uint32_t uid) const {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto it = mSessions.find(uid);
-        if(it != mSessions.end()){
-            return it->second.username;
+        if (auto info = find(uid)) {
+            return info->username;
         }
 
         return "Unknown";
     }
 
     std::shared_ptr<net::core::ISession> SessionManager::get(uint32_t uid) {
-        std::lock_guard<std::mutex> lock(mMutex);
-        auto it = mSessions.find(uid);
-        if(it != mSessions.end()){
-            return it->second.session;
+        if (auto info = find(uid)) {
+            return info->session;
         }
 
         return nullptr;
@@ -100,17 +124,17 @@ namespace net::server {
 
     
     size_t SessionManager::getCount() const {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mSessions.size();
+        size_t count = 0;
+        for(auto& shard: mShards) count += shard.sessions.load()->size();
+        return count;
     }
 
     
     std::vector<uint32_t> SessionManager::listIds() const {
         std::vector<uint32_t> ids;
-        {
-            std::lock_guard<std::mutex> lock(mMutex);
-            ids.reserve(mSessions.size());
-            for(auto& sessionInfo: mSessions){
+        for(auto& shard: mShards){
+            auto sessions = shard.sessions.load();
+            for(auto& sessionInfo: *sessions){
                 ids.push_back(sessionInfo.first);
             }
         }
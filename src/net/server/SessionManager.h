@@ -2,7 +2,9 @@
 
 #include <unordered_map>
 #include <vector>
+#include <array>
 #include <memory>
+#include <string>
 #include <cstdint>
 #include <chrono>
 #include <mutex>
@@ -10,11 +12,18 @@
 
 #include "net/core/ISession.h"
 #include "net/protocol/Message.h"
+#include "net/server/AtomicSnapshot.h"
+#include "net/server/Roster.h"
 
 namespace net::server {
 
+    // Session registry split into copy-on-write shards.
+    // Readers (get, getName, broadcast, sendTo, ...) only load shard snapshots and never lock;
+    // writers lock one shard, copy its map and publish the new version.
     class SessionManager {
     public:
+        static constexpr size_t kShardCount = 16;
+
         SessionManager() = default;
         SessionManager(const SessionManager&) = delete;
         SessionManager(SessionManager&&) = delete;
@@ -39,6 +48,9 @@ namespace net::server {
         size_t getCount() const;
         std::vector<uint32_t> listIds() const;
 
+        // uid -> name list kept in step with add/remove/setName
+        const Roster& roster() const { return mRoster; }
+
     private:
         struct SessionInfo {
             std::shared_ptr<net::core::ISession> session;
@@ -46,9 +58,21 @@ namespace net::server {
             std::string username {"guest"};
         };
 
-        mutable std::mutex mMutex; // marked mutable to allow locking it from const methods
+        using SessionMap = std::unordered_map<uint32_t, std::shared_ptr<const SessionInfo>>;
+
+        struct Shard {
+            std::mutex writeMutex;              // serializes writers only
+            AtomicSnapshot<SessionMap> sessions;
+        };
+
+        Shard& shardFor(uint32_t uid) { return mShards[uid % kShardCount]; }
+        const Shard& shardFor(uint32_t uid) const { return mShards[uid % kShardCount]; }
+
+        std::shared_ptr<const SessionInfo> find(uint32_t uid) const;
+
         std::atomic<uint32_t> mNextUid{1};
-        std::unordered_map<uint32_t, SessionInfo> mSessions;
+        std::array<Shard, kShardCount> mShards;
+        Roster mRoster;
     };
 
 } // namespace net::server
@@ -3,6 +3,8 @@
 
 using net::protocol::Message;
 using net::protocol::MessageType;
+using net::protocol::BodyEncoding;
+using net::protocol::SharedFrame;
 using net::protocol::json;
 
 namespace net::server::sessions {
@@ -35,7 +37,11 @@ namespace net::server::sessions {
     }
     
     void PlainSession::send(const net::protocol::Message& message) {
-        write(message);
+        write(SharedFrame(message, mEncoding));
+    }
+
+    void PlainSession::send(const net::protocol::SharedFrame& frame) {
+        write(frame);
     }
 
     void PlainSession::onMessage(const MessageCallback& handler) {
@@ -54,6 +60,14 @@ namespace net::server::sessions {
         return mUid;
     }
 
+    BodyEncoding PlainSession::getEncoding() const {
+        return mEncoding;
+    }
+
+    net::core::SessionStats PlainSession::stats() const {
+        return mWriteQueue.stats();
+    }
+
     void PlainSession::read() {
         readHeader();
     }
@@ -77,12 +91,14 @@ namespace net::server::sessions {
             return close();
         }
 
-        MessageType type = static_cast<MessageType>(mBuffer[0]);
-        std::vector<uint8_t> payload(mBuffer.begin() + net::protocol::kHeaderSize, mBuffer.end());
+        MessageType type = Message::typeFromByte(mBuffer[0]);
+        BodyEncoding encoding = Message::encodingFromByte(mBuffer[0]);
+        auto payload = std::span<const uint8_t>(mBuffer).subspan(net::protocol::kHeaderSize);
 
         try{
             if(mMessageCallback) {
-                Message message = Message::decode(type, payload);
+                Message message = Message::decode(type, payload, encoding);
+                mEncoding = encoding; // reply in whatever the peer speaks
                 mMessageCallback(message, self);
             }
         }catch(const std::exception& e){
@@ -128,20 +144,31 @@ namespace net::server::sessions {
         readBody(payloadSize);
     }
 
-    void PlainSession::write(const net::protocol::Message& message) {
+    void PlainSession::write(const net::protocol::SharedFrame& frame) {
+        auto self = shared_from_this();
+
+        // The queue is only touched on the socket's executor, which serializes concurrent senders.
+        boost::asio::post(mSocket.get_executor(), [this, self, frame]{
+            if (mIsClosed) return;
+            if (mWriteQueue.push(frame)) flush();
+        });
+    }
+
+    void PlainSession::flush() {
         auto self = shared_from_this();
-        auto bytes = std::make_shared<std::vector<uint8_t>>(message.encode()); // used shared pointer here to keep it alive
-
-        // The below prevents concurrent writes from effecting each other.
-        boost::asio::post(mSocket.get_executor(), [this, self, bytes]{
-            boost::asio::async_write(mSocket, boost::asio::buffer(*bytes), [this, self, bytes](auto ec, size_t){
-                if(ec) {
-                    if(mErrorCallback) mErrorCallback(ec.message(), self);
-                    boost::asio::post(mSocket.get_executor(), [this, self]{
-                        close();
-                    });
-                }
-            });
+
+        // One writev() for everything that piled up while the previous write was in flight
+        boost::asio::async_write(mSocket, mWriteQueue.beginFlush(), [this, self](auto ec, size_t){
+            if(ec) {
+                mWriteQueue.clear();
+                if(mErrorCallback) mErrorCallback(ec.message(), self);
+                boost::asio::post(mSocket.get_executor(), [this, self]{
+                    close();
+                });
+                return;
+            }
+
+            if (mWriteQueue.completeFlush()) flush();
         });
     }
 
@@ -9,6 +9,8 @@
 
 #include "net/core/ISession.h"
 #include "net/protocol/Message.h"
+#include "net/protocol/SharedFrame.h"
+#include "net/server/sessions/WriteQueue.h"
 
 namespace net::server::sessions {
     class PlainSession : public net::core::ISession {
@@ -24,6 +26,7 @@ namespace net::server::sessions {
         void onClose(const SessionCallback& handler) override;
         
         void send(const net::protocol::Message& message) override;
+        void send(const net::protocol::SharedFrame& frame) override;
         void onMessage(const MessageCallback& handler) override;
 
         
@@ -32,9 +35,13 @@ namespace net::server::sessions {
         void setUid(uint32_t uid) override;
         uint32_t getUid() const override;
 
+        net::protocol::BodyEncoding getEncoding() const override;
+
+        net::core::SessionStats stats() const override;
+
     protected:
         void read();
-        void write(const net::protocol::Message& message);
+        void write(const net::protocol::SharedFrame& frame);
     private:
         void readHeader();
         void readBody(size_t);
@@ -42,11 +49,15 @@ namespace net::server::sessions {
         void onHeaderRead(const boost::system::error_code& ec);
         void onBodyRead(const boost::system::error_code& ec, std::size_t payloadSize);
 
+        void flush();
+
     private:
         uint32_t mUid{};
         TcpSocket mSocket;
         std::vector<uint8_t> mBuffer;
+        WriteQueue mWriteQueue;
         std::atomic<bool> mIsClosed{false};
+        std::atomic<net::protocol::BodyEncoding> mEncoding{net::protocol::BodyEncoding::Json};
         
         // Event handlers
         SessionCallback mStartSessionCallback;
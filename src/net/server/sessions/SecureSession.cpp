@@ -2,6 +2,8 @@
 
 using net::protocol::Message;
 using net::protocol::MessageType;
+using net::protocol::BodyEncoding;
+using net::protocol::SharedFrame;
 
 namespace net::server::sessions {
 
@@ -49,7 +51,11 @@ namespace net::server::sessions {
     }
 
     void SecureSession::send(const Message& message) {
-        write(message);
+        write(SharedFrame(message, mEncoding));
+    }
+
+    void SecureSession::send(const SharedFrame& frame) {
+        write(frame);
     }
 
     void SecureSession::onMessage(const MessageCallback& handler) {
@@ -68,6 +74,14 @@ namespace net::server::sessions {
         return mUid;
     }
 
+    BodyEncoding SecureSession::getEncoding() const {
+        return mEncoding;
+    }
+
+    net::core::SessionStats SecureSession::stats() const {
+        return mWriteQueue.stats();
+    }
+
     void SecureSession::readHeader() {
         auto self = shared_from_this();
         mBuffer.resize(net::protocol::kHeaderSize);
@@ -109,15 +123,14 @@ namespace net::server::sessions {
                     return close();
                 }
 
-                MessageType type = static_cast<MessageType>(mBuffer[0]);
-                std::vector<uint8_t> payload(
-                    mBuffer.begin() + net::protocol::kHeaderSize,
-                    mBuffer.end()
-                );
+                MessageType type = Message::typeFromByte(mBuffer[0]);
+                BodyEncoding encoding = Message::encodingFromByte(mBuffer[0]);
+                auto payload = std::span<const uint8_t>(mBuffer).subspan(net::protocol::kHeaderSize);
 
                 try {
                     if (mMessageCallback) {
-                        Message msg = Message::decode(type, payload);
+                        Message msg = Message::decode(type, payload, encoding);
+                        mEncoding = encoding; // reply in whatever the peer speaks
                         mMessageCallback(msg, self);
                     }
                 } catch (const std::exception& e) {
@@ -130,23 +143,43 @@ namespace net::server::sessions {
         );
     }
 
-    void SecureSession::write(const Message& message) {
+    void SecureSession::write(const SharedFrame& frame) {
         auto self = shared_from_this();
-        auto bytes = std::make_shared<std::vector<uint8_t>>(message.encode());
 
+        // Only one async_write may be outstanding on an SSL stream; the queue enforces that.
         boost::asio::post(
             mStream.get_executor(),
-            [this, self, bytes]() {
-                boost::asio::async_write(
-                    mStream,
-                    boost::asio::buffer(*bytes),
-                    [this, self, bytes](auto ec, std::size_t) {
-                        if (ec) {
-                            if (mErrorCallback) mErrorCallback(ec.message(), self);
-                            close();
-                        }
-                    }
-                );
+            [this, self, frame]() {
+                if (mIsClosed) return;
+                if (mWriteQueue.push(frame)) flush();
+            }
+        );
+    }
+
+    void SecureSession::flush() {
+        auto self = shared_from_this();
+        const auto& buffers = mWriteQueue.beginFlush();
+
+        // asio's SSL stream encrypts one buffer per write_some, so a gather write would still
+        // produce one TLS record per frame. Coalesce the batch into a single buffer instead.
+        boost::asio::const_buffer batch = buffers.front();
+        if (buffers.size() > 1) {
+            mWriteStaging.resize(boost::asio::buffer_size(buffers));
+            boost::asio::buffer_copy(boost::asio::buffer(mWriteStaging), buffers);
+            batch = boost::asio::buffer(mWriteStaging);
+        }
+
+        boost::asio::async_write(
+            mStream,
+            batch,
+            [this, self](auto ec, std::size_t) {
+                if (ec) {
+                    mWriteQueue.clear();
+                    if (mErrorCallback) mErrorCallback(ec.message(), self);
+                    return close();
+                }
+
+                if (mWriteQueue.completeFlush()) flush();
             }
         );
     }
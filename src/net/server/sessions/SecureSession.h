@@ -8,6 +8,8 @@
 
 #include "net/core/ISession.h"
 #include "net/protocol/Message.h"
+#include "net/protocol/SharedFrame.h"
+#include "net/server/sessions/WriteQueue.h"
 
 namespace net::server::sessions {
 
@@ -26,6 +28,7 @@ public:
     void onClose(const SessionCallback& handler) override;
 
     void send(const net::protocol::Message& message) override;
+    void send(const net::protocol::SharedFrame& frame) override;
     void onMessage(const MessageCallback& handler) override;
 
     void onError(const ErrorCallback& handler) override;
@@ -33,17 +36,25 @@ public:
     void setUid(uint32_t uid) override;
     uint32_t getUid() const override;
 
+    net::protocol::BodyEncoding getEncoding() const override;
+
+    net::core::SessionStats stats() const override;
+
 private:
     void doHandshake();
     void readHeader();
     void readBody(std::size_t payloadSize);
-    void write(const net::protocol::Message& message);
+    void write(const net::protocol::SharedFrame& frame);
+    void flush();
 
 private:
     uint32_t mUid{};
     SslStream mStream;
     std::vector<uint8_t> mBuffer;
+    WriteQueue mWriteQueue;
+    std::vector<uint8_t> mWriteStaging; // coalesced batch, see flush()
     std::atomic<bool> mIsClosed{false};
+    std::atomic<net::protocol::BodyEncoding> mEncoding{net::protocol::BodyEncoding::Json};
 
     // Callbacks
     SessionCallback mStartSessionCallback;
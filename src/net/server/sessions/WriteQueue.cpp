@@ -0,0 +1,61 @@
+#include "net/server/sessions/WriteQueue.h"
+
+namespace net::server::sessions {
+
+    bool WriteQueue::push(const net::protocol::SharedFrame& frame) {
+        mPending.push_back(frame);
+        mQueuedFrames.fetch_add(1, std::memory_order_relaxed);
+        mBytesPending.fetch_add(frame.size(), std::memory_order_relaxed);
+
+        if (mWriting) return false;
+        mWriting = true;
+        return true;
+    }
+
+    const WriteQueue::BufferSequence& WriteQueue::beginFlush() {
+        // Swapping keeps the capacity of both vectors, so steady state does not allocate
+        mInFlight.swap(mPending);
+
+        mBuffers.clear();
+        for (const auto& frame : mInFlight) {
+            mBuffers.emplace_back(frame.data(), frame.size());
+        }
+        return mBuffers;
+    }
+
+    bool WriteQueue::completeFlush() {
+        size_t bytes = 0;
+        for (const auto& frame : mInFlight) bytes += frame.size();
+
+        mQueuedFrames.fetch_sub(mInFlight.size(), std::memory_order_relaxed);
+        mBytesPending.fetch_sub(bytes, std::memory_order_relaxed);
+        mFramesSent.fetch_add(mInFlight.size(), std::memory_order_relaxed);
+        mBytesSent.fetch_add(bytes, std::memory_order_relaxed);
+
+        mInFlight.clear();
+        mBuffers.clear();
+
+        mWriting = !mPending.empty();
+        return mWriting;
+    }
+
+    void WriteQueue::clear() {
+        mPending.clear();
+        mInFlight.clear();
+        mBuffers.clear();
+        mWriting = false;
+
+        mQueuedFrames.store(0, std::memory_order_relaxed);
+        mBytesPending.store(0, std::memory_order_relaxed);
+    }
+
+    net::core::SessionStats WriteQueue::stats() const {
+        net::core::SessionStats s;
+        s.queuedFrames = mQueuedFrames.load(std::memory_order_relaxed);
+        s.bytesPending = mBytesPending.load(std::memory_order_relaxed);
+        s.framesSent   = mFramesSent.load(std::memory_order_relaxed);
+        s.bytesSent    = mBytesSent.load(std::memory_order_relaxed);
+        return s;
+    }
+
+} // namespace net::server::sessions
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <boost/asio/buffer.hpp>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+#include "net/core/ISession.h"
+#include "net/protocol/SharedFrame.h"
+
+namespace net::server::sessions {
+
+    // Outgoing frame queue of a session. Allows a single outstanding write; frames queued
+    // while it is in flight are flushed together as one gather write once it completes.
+    // Must only be used from the session's executor. stats() may be called from any thread.
+    class WriteQueue {
+    public:
+        using BufferSequence = std::vector<boost::asio::const_buffer>;
+
+        // Queues a frame. Returns true if no write is outstanding and the caller should flush().
+        bool push(const net::protocol::SharedFrame& frame);
+
+        // Moves everything queued into the in-flight batch and returns its buffers.
+        const BufferSequence& beginFlush();
+
+        // Releases the in-flight batch. Returns true if more frames were queued meanwhile.
+        bool completeFlush();
+
+        // Drops queued and in-flight frames (after an error / close).
+        void clear();
+
+        net::core::SessionStats stats() const;
+
+    private:
+        std::vector<net::protocol::SharedFrame> mPending;
+        std::vector<net::protocol::SharedFrame> mInFlight;
+        BufferSequence mBuffers;
+        bool mWriting{false};
+
+        std::atomic<size_t> mQueuedFrames{0};
+        std::atomic<size_t> mBytesPending{0};
+        std::atomic<uint64_t> mFramesSent{0};
+        std::atomic<uint64_t> mBytesSent{0};
+    };
+
+} // namespace net::server::sessions
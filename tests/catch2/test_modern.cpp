@@ -1,21 +1,67 @@
 #include <catch2/catch_all.hpp>
+#include <openssl/bn.h>
+#include <openssl/evp.h>
 #include <vector>
 #include <algorithm>
+#include <bit>
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <atomic>
+#include <thread>
 
 #include "crypto/modern/symmetric/block/AES.h"
+#include "crypto/modern/symmetric/block/AESNI.h"
+#include "crypto/modern/symmetric/block/AESBitsliced.h"
 #include "crypto/modern/symmetric/block/DES.h"
+#include "crypto/modern/symmetric/block/DESKeySearch.h"
+#include "crypto/modern/symmetric/block/TripleDES.h"
+#include "crypto/modern/symmetric/mode/CBC.h"
+#include "crypto/modern/symmetric/mode/CTR.h"
+#include "crypto/modern/symmetric/mode/GCM.h"
+#include "crypto/standard/openssl/AESCBC.h"
+#include "crypto/modern/asymmetric/BigInt.h"
 #include "crypto/modern/asymmetric/RSA.h"
 #include "crypto/core/utils.h"
 
 using namespace crypto::core;
 using namespace crypto::modern;
 
+namespace {
+    // FIPS-197 Appendix C.1 - C.3: {key, ciphertext} pairs for kAesPlaintext
+    const std::array<std::pair<std::string, std::string>, 3> kAesVectors = {{
+        { "000102030405060708090a0b0c0d0e0f", "69c4e0d86a7b0430d8cdb78070b4c55a" },
+        { "000102030405060708090a0b0c0d0e0f1011121314151617", "dda97ca4864cdfe06eaf70a0ec0d7191" },
+        { "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", "8ea2b7ca516745bfeafc49904b496089" }
+    }};
+    const Bytes kAesPlaintext = utils::fromHex("00112233445566778899aabbccddeeff");
+
+    // Block-by-block encryption with the reference AES engine, to check the batched paths against
+    Bytes referenceEncrypt(const Bytes& key, const Bytes& data) {
+        block::symmetric::AES reference(key.size(), block::symmetric::AES::Engine::Reference);
+        reference.setKey(key);
+
+        Bytes expected(data.size());
+        for (size_t i = 0; i < data.size() / 16; ++i) {
+            Bytes block(data.begin() + 16 * i, data.begin() + 16 * (i + 1)), out;
+            reference.encryptBlock(block, out);
+            std::copy(out.begin(), out.end(), expected.begin() + 16 * i);
+        }
+        return expected;
+    }
+}
+
 // ============================================================
 // MANUAL AES-128 NIST VALIDATION
 // ============================================================
 TEST_CASE("Modern AES: NIST Standard Vector Validation", "[modern][aes][nist]") {
     block::symmetric::AES aes(16);
     aes.setKey(utils::fromHex("000102030405060708090a0b0c0d0e0f"));
+
+    // Table lookups are opt-in; the default stays on the reference rounds
+    REQUIRE(aes.engine() == block::symmetric::AES::Engine::Reference);
     
     SECTION("Encryption matches Appendix C.1") {
         Bytes pt = utils::fromHex("00112233445566778899aabbccddeeff");
@@ -26,6 +72,148 @@ TEST_CASE("Modern AES: NIST Standard Vector Validation", "[modern][aes][nist]")
     }
 }
 
+TEST_CASE("Modern AES: T-table engine matches the reference", "[modern][aes][nist]") {
+    using block::symmetric::AES;
+
+    for (auto engine : { AES::Engine::Reference, AES::Engine::TTable }) {
+        for (const auto& [key, ct] : kAesVectors) {
+            DYNAMIC_SECTION("Engine " << static_cast<int>(engine) << ", key bits " << key.size() * 4) {
+                AES aes(key.size() / 2, engine);
+                aes.setKey(utils::fromHex(key));
+
+                Bytes actualCt, actualPt;
+                aes.encryptBlock(kAesPlaintext, actualCt);
+                REQUIRE(utils::toHex(actualCt) == ct);
+
+                aes.decryptBlock(actualCt, actualPt);
+                REQUIRE(actualPt == kAesPlaintext);
+            }
+        }
+    }
+
+    SECTION("Random keys and blocks") {
+        std::mt19937 rng(2024);
+        auto randomBytes = [&rng](size_t n) {
+            Bytes b(n);
+            for (auto& x : b) x = static_cast<uint8_t>(rng());
+            return b;
+        };
+
+        for (size_t keySize : { 16u, 24u, 32u }) {
+            AES reference(keySize, AES::Engine::Reference);
+            AES table(keySize, AES::Engine::TTable);
+            Bytes key = randomBytes(keySize);
+            reference.setKey(key);
+            table.setKey(key);
+
+            for (int i = 0; i < 200; ++i) {
+                Bytes block = randomBytes(16);
+                Bytes a, b;
+                reference.encryptBlock(block, a);
+                table.encryptBlock(block, b);
+                REQUIRE(a == b);
+
+                reference.decryptBlock(block, a);
+                table.decryptBlock(block, b);
+                REQUIRE(a == b);
+            }
+        }
+    }
+}
+
+TEST_CASE("Modern AES-NI: Matches portable AES", "[modern][aes][nist]") {
+    using block::symmetric::AESNI;
+
+    INFO("AES-NI available: " << AESNI::isSupported());
+
+    for (const auto& [key, ct] : kAesVectors) {
+        DYNAMIC_SECTION("FIPS-197, key bits " << key.size() * 4) {
+            AESNI aes(key.size() / 2);
+            aes.setKey(utils::fromHex(key));
+            REQUIRE(aes.usesHardware() == AESNI::isSupported());
+
+            Bytes actualCt, actualPt;
+            aes.encryptBlock(kAesPlaintext, actualCt);
+            REQUIRE(utils::toHex(actualCt) == ct);
+
+            aes.decryptBlock(actualCt, actualPt);
+            REQUIRE(actualPt == kAesPlaintext);
+        }
+    }
+
+    SECTION("Multi-block path covers 8-, 4- and 1-block tails") {
+        std::mt19937 rng(7);
+        for (size_t keySize : { 16u, 24u, 32u }) {
+            Bytes key(keySize);
+            for (auto& x : key) x = static_cast<uint8_t>(rng());
+
+            AESNI aes(keySize);
+            aes.setKey(key);
+
+            constexpr size_t kBlocks = 8 + 4 + 3;
+            Bytes data(kBlocks * 16);
+            for (auto& x : data) x = static_cast<uint8_t>(rng());
+
+            Bytes actual(data.size());
+            aes.encryptBlocks(data, actual, kBlocks);
+            REQUIRE(actual == referenceEncrypt(key, data));
+
+            // In place
+            aes.decryptBlocks(actual, actual, kBlocks);
+            REQUIRE(actual == data);
+        }
+    }
+}
+
+TEST_CASE("Modern AES bitsliced: Matches the reference engine", "[modern][aes][nist]") {
+    using block::symmetric::AESBitsliced;
+
+    for (const auto& [key, ct] : kAesVectors) {
+        DYNAMIC_SECTION("FIPS-197, key bits " << key.size() * 4) {
+            AESBitsliced aes(key.size() / 2);
+            aes.setKey(utils::fromHex(key));
+
+            Bytes actualCt, actualPt;
+            aes.encryptBlock(kAesPlaintext, actualCt);
+            REQUIRE(utils::toHex(actualCt) == ct);
+
+            aes.decryptBlock(actualCt, actualPt);
+            REQUIRE(actualPt == kAesPlaintext);
+        }
+    }
+
+    SECTION("Full and partial batches") {
+        std::mt19937 rng(13);
+        for (size_t keySize : { 16u, 24u, 32u }) {
+            Bytes key(keySize);
+            for (auto& x : key) x = static_cast<uint8_t>(rng());
+
+            AESBitsliced aes(keySize);
+            aes.setKey(key);
+
+            // Two full batches, then a tail that leaves the second 4-block lane empty
+            constexpr size_t kBlocks = 2 * AESBitsliced::BATCH_BLOCKS + 3;
+            Bytes data(kBlocks * 16);
+            for (auto& x : data) x = static_cast<uint8_t>(rng());
+
+            Bytes actual(data.size());
+            aes.encryptBlocks(data, actual, kBlocks);
+            REQUIRE(actual == referenceEncrypt(key, data));
+
+            // In place
+            aes.decryptBlocks(actual, actual, kBlocks);
+            REQUIRE(actual == data);
+        }
+    }
+
+    SECTION("Rejects bad sizes") {
+        REQUIRE_THROWS_AS(AESBitsliced(20), std::invalid_argument);
+
+        AESBitsliced aes(16);
+        REQUIRE_THROWS_AS(aes.setKey(Bytes(24, 0)), std::invalid_argument);
+    }
+}
+
 // ============================================================
 // MANUAL DES NIST VALIDATION
 // ============================================================
@@ -36,6 +224,9 @@ TEST_CASE("Modern DES: Standard Vector Validation", "[modern][des][nist]") {
     // Plaintext: 4E6F772069732074 ("Now is t")
     // Expected Ciphertext: 3FA40E8A984D4815
     des.setKey(utils::fromHex("0123456789ABCDEF"));
+
+    // SP-box tables are opt-in; the default stays on the reference rounds
+    REQUIRE(des.engine() == block::symmetric::DES::Engine::Reference);
     
     SECTION("Block Encryption correctness") {
         Bytes pt = utils::fromHex("4E6F772069732074");
@@ -54,6 +245,432 @@ TEST_CASE("Modern DES: Standard Vector Validation", "[modern][des][nist]") {
     }
 }
 
+TEST_CASE("Modern DES: Engines agree", "[modern][des]") {
+    using block::symmetric::DES;
+
+    // FIPS 81 / "Validating the Correctness of Hardware Implementations of the NBS DES"
+    const std::array<std::array<const char*, 3>, 3> vectors = {{
+        { "0123456789ABCDEF", "4E6F772069732074", "3FA40E8A984D4815" },
+        { "0101010101010101", "95F8A5E5DD31D900", "8000000000000000" },
+        { "7CA110454A1A6E57", "01A1D6D039776742", "690F5B0D9A26939B" }
+    }};
+
+    for (auto engine : { DES::Engine::Reference, DES::Engine::SPBox }) {
+        DYNAMIC_SECTION("Engine " << static_cast<int>(engine)) {
+            DES des(engine);
+            REQUIRE(des.engine() == engine);
+            for (const auto& [key, pt, ct] : vectors) {
+                des.setKey(utils::fromHex(key));
+
+                Bytes actualCt, actualPt;
+                des.encryptBlock(utils::fromHex(pt), actualCt);
+                REQUIRE(utils::toHex(actualCt) == utils::toHex(utils::fromHex(ct)));
+
+                des.decryptBlock(actualCt, actualPt);
+                REQUIRE(utils::toHex(actualPt) == utils::toHex(utils::fromHex(pt)));
+            }
+        }
+    }
+
+    SECTION("Random keys and blocks") {
+        std::mt19937 rng(46);
+        auto randomBytes = [&rng](size_t n) {
+            Bytes b(n);
+            for (auto& x : b) x = static_cast<uint8_t>(rng());
+            return b;
+        };
+
+        DES reference(DES::Engine::Reference), spbox(DES::Engine::SPBox);
+        for (int k = 0; k < 20; ++k) {
+            Bytes key = randomBytes(8);
+            reference.setKey(key);
+            spbox.setKey(key);
+
+            for (int i = 0; i < 50; ++i) {
+                Bytes block = randomBytes(8);
+                Bytes a, b;
+                reference.encryptBlock(block, a);
+                spbox.encryptBlock(block, b);
+                REQUIRE(a == b);
+
+                reference.decryptBlock(block, a);
+                spbox.decryptBlock(block, b);
+                REQUIRE(a == b);
+            }
+        }
+    }
+}
+
+TEST_CASE("Modern DES: Bitsliced key search", "[modern][des]") {
+    using namespace block::symmetric;
+
+    std::mt19937_64 rng(56);
+    const uint64_t secret = rng() % DESKeySearch::KEY_SPACE;
+    const Bytes key = DESKeySearch::keyFromIndex(secret);
+    const Bytes pt = utils::fromHex("4E6F772069732074");
+
+    DES des;
+    des.setKey(key);
+    Bytes ct;
+    des.encryptBlock(pt, ct);
+
+    DESKeySearch search(pt, ct);
+
+    SECTION("Key index encoding") {
+        REQUIRE(DESKeySearch::indexFromKey(key) == secret);
+        for (uint8_t b : key) REQUIRE(std::popcount(b) % 2 == 1);
+        REQUIRE(DESKeySearch::keyFromIndex(0) == utils::fromHex("0101010101010101"));
+        REQUIRE(DESKeySearch::indexFromKey(utils::fromHex("0123456789ABCDEF")) ==
+                DESKeySearch::indexFromKey(utils::fromHex("0022446688AACCEE")));
+    }
+
+    SECTION("One pass flags exactly the matching lane") {
+        uint64_t base = secret - secret % DESKeySearch::KEYS_PER_PASS;
+        REQUIRE(search.matchLanes(base) == uint64_t{1} << (secret - base));
+        REQUIRE(search.matchLanes(base ^ 0x40) == 0);
+        REQUIRE_THROWS_AS(search.matchLanes(base + 1), std::invalid_argument);
+    }
+
+    SECTION("FIPS 46-3 vector") {
+        DESKeySearch fips(pt, utils::fromHex("3FA40E8A984D4815"));
+        uint64_t index = DESKeySearch::indexFromKey(utils::fromHex("0123456789ABCDEF"));
+        auto found = fips.search(index - 1000, 5000, 2);
+        REQUIRE(found == index);
+    }
+
+    SECTION("Ranges and threads") {
+        for (unsigned threads : { 1u, 3u }) {
+            // Unaligned ranges that start, end or miss exactly at the key
+            REQUIRE(search.search(secret - 20000, 40000, threads) == secret);
+            REQUIRE(search.search(secret, 1, threads) == secret);
+            REQUIRE(search.search(secret - 99, 100, threads) == secret);
+            REQUIRE_FALSE(search.search(secret - 99, 99, threads).has_value());
+            REQUIRE_FALSE(search.search(secret + 1, 5000, threads).has_value());
+        }
+        REQUIRE_FALSE(search.search(0, 0).has_value());
+        REQUIRE_THROWS_AS(search.search(DESKeySearch::KEY_SPACE - 10, 11), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Modern block ciphers: Span API matches per-block calls", "[modern][aes][des]") {
+    using namespace block::symmetric;
+    using crypto::core::symmetric::IBlockCipher;
+
+    std::vector<std::pair<std::string, std::unique_ptr<IBlockCipher>>> ciphers;
+    ciphers.emplace_back("AES reference", std::make_unique<AES>(16, AES::Engine::Reference));
+    ciphers.emplace_back("AES T-table", std::make_unique<AES>(16, AES::Engine::TTable));
+    ciphers.emplace_back("AES-NI", std::make_unique<AESNI>(16));
+    ciphers.emplace_back("AES bitsliced", std::make_unique<AESBitsliced>(16));
+    ciphers.emplace_back("DES reference", std::make_unique<DES>(DES::Engine::Reference));
+    ciphers.emplace_back("DES SP-box", std::make_unique<DES>(DES::Engine::SPBox));
+    ciphers.emplace_back("3DES-EDE", std::make_unique<TripleDES>(24));
+
+    std::mt19937 rng(21);
+    for (auto& [name, cipher] : ciphers) {
+        DYNAMIC_SECTION(name) {
+            Bytes key(cipher->keySize());
+            for (auto& x : key) x = static_cast<uint8_t>(rng());
+            cipher->setKey(key);
+
+            const size_t bs = cipher->blockSize();
+            constexpr size_t kBlocks = 37;
+            Bytes data(kBlocks * bs);
+            for (auto& x : data) x = static_cast<uint8_t>(rng());
+
+            Bytes expected(data.size());
+            for (size_t i = 0; i < kBlocks; ++i) {
+                Bytes block(data.begin() + bs * i, data.begin() + bs * (i + 1)), out;
+                cipher->encryptBlock(block, out);
+                REQUIRE(out.size() == bs);
+                std::copy(out.begin(), out.end(), expected.begin() + bs * i);
+            }
+
+            Bytes actual(data.size());
+            cipher->encryptBlocks(data, actual, kBlocks);
+            REQUIRE(actual == expected);
+
+            cipher->decryptBlocks(actual, actual, kBlocks);
+            REQUIRE(actual == data);
+
+            // Spans shorter than nblocks * blockSize() are rejected
+            REQUIRE_THROWS_AS(cipher->encryptBlocks(data, std::span<uint8_t>(actual).first(bs), 2),
+                              std::invalid_argument);
+        }
+    }
+}
+
+// ============================================================
+// CIPHER MODES
+// ============================================================
+TEST_CASE("Modern modes: CBC matches OpenSSL AES-CBC", "[modern][mode][cbc]") {
+    using namespace block::symmetric;
+    using mode::symmetric::CBC;
+    using crypto::standard::openssl::AESCBC;
+    using crypto::standard::openssl::AESKeySize;
+
+    std::mt19937 rng(31);
+    auto random = [&](size_t n) {
+        Bytes b(n);
+        for (auto& x : b) x = static_cast<uint8_t>(rng());
+        return b;
+    };
+
+    for (size_t keySize : { 16u, 24u, 32u }) {
+        Bytes key = random(keySize), iv = random(16);
+
+        auto aes = std::make_shared<AESNI>(keySize);
+        aes->setKey(key);
+        CBC cbc(aes);
+        cbc.setIV(iv);
+
+        AESCBC reference(static_cast<AESKeySize>(keySize));
+        reference.setKey(key);
+        reference.setIV(iv);
+
+        for (size_t size : { 0u, 1u, 15u, 16u, 17u, 100u, 4096u }) {
+            Bytes pt = random(size);
+            Bytes ct = cbc.encrypt(pt);
+            REQUIRE(ct == reference.encrypt(pt));
+            REQUIRE(cbc.decrypt(ct) == pt);
+        }
+    }
+
+    SECTION("Threaded decryption matches serial") {
+        auto aes = std::make_shared<AES>(16);
+        aes->setKey(random(16));
+        CBC cbc(aes);
+        cbc.setIV(random(16));
+
+        Bytes pt = random(4 * CBC::PARALLEL_MIN_BYTES + 5);
+        Bytes ct = cbc.encrypt(pt);
+
+        cbc.setThreads(4);
+        REQUIRE(cbc.decrypt(ct) == pt);
+        cbc.setThreads(1);
+        REQUIRE(cbc.decrypt(ct) == pt);
+    }
+
+    SECTION("DES block size, padding and IV checks") {
+        auto des = std::make_shared<DES>();
+        des->setKey(random(8));
+        CBC cbc(des);
+
+        REQUIRE_THROWS_AS(cbc.encrypt(Bytes(8, 0)), std::runtime_error);
+        REQUIRE_THROWS_AS(cbc.setIV(Bytes(16, 0)), std::invalid_argument);
+        cbc.setIV(random(8));
+
+        Bytes pt = random(21);
+        Bytes ct = cbc.encrypt(pt);
+        REQUIRE(ct.size() == 24);
+        REQUIRE(cbc.decrypt(ct) == pt);
+
+        REQUIRE_THROWS_AS(cbc.decrypt(Bytes(ct.begin(), ct.end() - 1)), std::invalid_argument);
+
+        // Block-aligned plaintext gets a full block of padding; corrupting it must be detected
+        Bytes aligned = cbc.encrypt(random(16));
+        REQUIRE(aligned.size() == 24);
+        aligned[aligned.size() - 9] ^= 0x01; // flips a bit of the last plaintext block
+        REQUIRE_THROWS_AS(cbc.decrypt(aligned), std::runtime_error);
+    }
+}
+
+TEST_CASE("Modern modes: CTR", "[modern][mode][ctr]") {
+    using namespace block::symmetric;
+    using mode::symmetric::CTR;
+
+    SECTION("NIST SP 800-38A F.5.1 (counter carries across bytes)") {
+        auto aes = std::make_shared<AES>(16);
+        aes->setKey(utils::fromHex("2b7e151628aed2a6abf7158809cf4f3c"));
+        CTR ctr(aes);
+        ctr.setIV(utils::fromHex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff"));
+
+        Bytes pt = utils::fromHex(
+            "6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+            "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710");
+        std::string ct =
+            "874d6191b620e3261bef6864990db6ce9806f66b7970fdff8617187bb9fffdff"
+            "5ae4df3edbd5d35e5b4f09020db03eab1e031dda2fbe03d1792170a0f3009cee";
+
+        REQUIRE(utils::toHex(ctr.encrypt(pt)) == ct);
+        REQUIRE(ctr.decrypt(utils::fromHex(ct)) == pt);
+    }
+
+    SECTION("Threaded keystream matches serial, including a partial last block") {
+        std::mt19937 rng(41);
+        Bytes key(16), iv(16, 0xff), pt(4 * CTR::PARALLEL_MIN_BYTES + 7);
+        for (auto& x : key) x = static_cast<uint8_t>(rng());
+        for (auto& x : pt) x = static_cast<uint8_t>(rng());
+
+        auto aes = std::make_shared<AESNI>(16);
+        aes->setKey(key);
+        CTR ctr(aes);
+        ctr.setIV(iv);
+
+        ctr.setThreads(1);
+        Bytes serial = ctr.encrypt(pt);
+        ctr.setThreads(4);
+        REQUIRE(ctr.encrypt(pt) == serial);
+        REQUIRE(ctr.decrypt(serial) == pt);
+    }
+}
+
+TEST_CASE("Modern modes: GCM", "[modern][mode][gcm]") {
+    using namespace block::symmetric;
+    using mode::symmetric::GCM;
+
+    INFO("PCLMULQDQ GHASH: " << GCM::usesCarrylessMultiply());
+
+    // Table runs the portable GHASH even where Auto would pick PCLMULQDQ, so both paths are covered
+    for (auto engine : { GCM::GHashEngine::Auto, GCM::GHashEngine::Table }) {
+        DYNAMIC_SECTION("GHASH engine " << static_cast<int>(engine)) {
+            SECTION("GCM spec test case 2") {
+                auto aes = std::make_shared<AES>(16);
+                aes->setKey(Bytes(16, 0));
+                GCM gcm(aes, engine);
+                gcm.setIV(Bytes(12, 0));
+
+                Bytes out = gcm.encrypt(Bytes(16, 0));
+                REQUIRE(utils::toHex(out) == "0388dace60b6a392f328c2b971b2fe78ab6e47d42cec13bdf53a67b21257bddf");
+            }
+
+            SECTION("GCM spec test case 4 (AAD, partial block)") {
+                auto aes = std::make_shared<AESNI>(16);
+                aes->setKey(utils::fromHex("feffe9928665731c6d6a8f9467308308"));
+                GCM gcm(aes, engine);
+                gcm.setIV(utils::fromHex("cafebabefacedbaddecaf888"));
+                gcm.setAAD(utils::fromHex("feedfacedeadbeeffeedfacedeadbeefabaddad2"));
+
+                Bytes pt = utils::fromHex(
+                    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+                    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39");
+                Bytes out = gcm.encrypt(pt);
+                REQUIRE(utils::toHex(out) ==
+                    "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+                    "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091"
+                    "5bc94fbc3221a5db94fae95ae7121a47");
+                REQUIRE(gcm.decrypt(out) == pt);
+
+                out[3] ^= 0x80;
+                REQUIRE_THROWS_AS(gcm.decrypt(out), std::runtime_error);
+
+                // The nonce seals one message; encrypting again needs a new setIV()
+                REQUIRE_THROWS_AS(gcm.encrypt(pt), std::runtime_error);
+                gcm.setIV(utils::fromHex("cafebabefacedbaddecaf889"));
+                REQUIRE(gcm.decrypt(gcm.encrypt(pt)) == pt);
+            }
+
+            SECTION("Matches OpenSSL for arbitrary IV lengths and sizes") {
+                std::mt19937 rng(51);
+                auto random = [&](size_t n) {
+                    Bytes b(n);
+                    for (auto& x : b) x = static_cast<uint8_t>(rng());
+                    return b;
+                };
+
+                for (size_t ivSize : { 1u, 12u, 16u, 60u }) {
+                    for (size_t size : { 0u, 5u, 64u, 1000u }) {
+                        Bytes key = random(32), iv = random(ivSize), aad = random(size % 37), pt = random(size);
+
+                        auto aes = std::make_shared<AES>(32);
+                        aes->setKey(key);
+                        GCM gcm(aes, engine);
+                        gcm.setIV(iv);
+                        gcm.setAAD(aad);
+                        Bytes actual = gcm.encrypt(pt);
+
+                        EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+                        Bytes expected(size + GCM::TAG_SIZE);
+                        int len = 0;
+                        REQUIRE(EVP_EncryptInit_ex(ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1);
+                        REQUIRE(EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(ivSize), nullptr) == 1);
+                        REQUIRE(EVP_EncryptInit_ex(ctx, nullptr, nullptr, key.data(), iv.data()) == 1);
+                        REQUIRE(EVP_EncryptUpdate(ctx, nullptr, &len, aad.data(), static_cast<int>(aad.size())) == 1);
+                        REQUIRE(EVP_EncryptUpdate(ctx, expected.data(), &len, pt.data(), static_cast<int>(size)) == 1);
+                        REQUIRE(EVP_EncryptFinal_ex(ctx, expected.data() + len, &len) == 1);
+                        REQUIRE(EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, expected.data() + size) == 1);
+                        EVP_CIPHER_CTX_free(ctx);
+
+                        INFO("iv " << ivSize << " bytes, data " << size << " bytes");
+                        REQUIRE(actual == expected);
+                        REQUIRE(gcm.decrypt(actual) == pt);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Rejects 64-bit block ciphers") {
+        REQUIRE_THROWS_AS(GCM(std::make_shared<DES>()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Modern 3DES-EDE: Matches OpenSSL DES-EDE-CBC", "[modern][des][cbc]") {
+    using namespace block::symmetric;
+    using mode::symmetric::CBC;
+
+    std::mt19937 rng(67);
+    auto random = [&](size_t n) {
+        Bytes b(n);
+        for (auto& x : b) x = static_cast<uint8_t>(rng());
+        return b;
+    };
+
+    SECTION("Degenerate keys reduce to single DES") {
+        Bytes k = random(8);
+        DES des;
+        des.setKey(k);
+
+        Bytes k3 = k, k2 = k;
+        k3.insert(k3.end(), k.begin(), k.end());
+        k3.insert(k3.end(), k.begin(), k.end());
+        k2.insert(k2.end(), k.begin(), k.end());
+        TripleDES threeKey(24), twoKey(16);
+        threeKey.setKey(k3);
+        twoKey.setKey(k2);
+
+        Bytes pt = random(8), a, b, c;
+        des.encryptBlock(pt, a);
+        threeKey.encryptBlock(pt, b);
+        twoKey.encryptBlock(pt, c);
+        REQUIRE(a == b);
+        REQUIRE(a == c);
+    }
+
+    for (size_t keySize : { size_t{16}, size_t{24} }) {
+        for (size_t size : { size_t{0}, size_t{7}, size_t{8}, size_t{1000}, size_t{1} << 20 }) {
+            DYNAMIC_SECTION(keySize << "-byte key, " << size << " bytes") {
+                Bytes key = random(keySize), iv = random(8), pt = random(size);
+
+                auto tdes = std::make_shared<TripleDES>(keySize);
+                tdes->setKey(key);
+                CBC cbc(tdes);
+                cbc.setIV(iv);
+                cbc.setThreads(4); // large inputs take the parallel decrypt path
+                Bytes actual = cbc.encrypt(pt);
+
+                EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+                Bytes expected(size + 8);
+                int len = 0, tail = 0;
+                REQUIRE(EVP_EncryptInit_ex(ctx, keySize == 24 ? EVP_des_ede3_cbc() : EVP_des_ede_cbc(),
+                                           nullptr, key.data(), iv.data()) == 1);
+                REQUIRE(EVP_EncryptUpdate(ctx, expected.data(), &len, pt.data(), static_cast<int>(size)) == 1);
+                REQUIRE(EVP_EncryptFinal_ex(ctx, expected.data() + len, &tail) == 1);
+                EVP_CIPHER_CTX_free(ctx);
+                expected.resize(len + tail);
+
+                REQUIRE(actual == expected);
+                REQUIRE(cbc.decrypt(actual) == pt);
+            }
+        }
+    }
+
+    SECTION("Key sizes") {
+        REQUIRE_THROWS_AS(TripleDES(8), std::invalid_argument);
+        TripleDES tdes(24);
+        REQUIRE_THROWS_AS(tdes.setKey(Bytes(16, 0)), std::invalid_argument);
+    }
+}
+
 // ============================================================
 // MANUAL RSA EDUCATIONAL VALIDATION
 // ============================================================
@@ -62,13 +679,172 @@ TEST_CASE("Modern RSA: Educational Logic Check", "[modern][rsa]") {
     auto kp = rsa.generateKeyPair(1024);
 
     SECTION("Single Byte Roundtrip") {
-        // Use a value smaller than n (n=3233 in our demo primes)
         Bytes pt = { 'K' }; // ASCII 75
         Bytes ct = rsa.encrypt(pt, kp.public_key);
+        REQUIRE(ct.size() == 128);
         Bytes decrypted = rsa.decrypt(ct, kp.private_key);
         
         REQUIRE(decrypted == pt);
     }
+
+    SECTION("Message framing") {
+        // Empty, leading zeros and the longest message that fits (modulus bytes - 2)
+        for (size_t size : { size_t{0}, size_t{1}, size_t{32}, size_t{126} }) {
+            Bytes pt(size, 0x00);
+            for (size_t i = size / 2; i < size; ++i) pt[i] = static_cast<uint8_t>(i);
+            REQUIRE(rsa.decrypt(rsa.encrypt(pt, kp.public_key), kp.private_key) == pt);
+        }
+        REQUIRE_THROWS_AS(rsa.encrypt(Bytes(127, 0x01), kp.public_key), std::invalid_argument);
+    }
+
+    SECTION("CRT, blinding and the legacy [n][d] layout agree") {
+        Bytes pt = utils::fromHex("00c0ffee");
+        Bytes ct = rsa.encrypt(pt, kp.public_key);
+        REQUIRE(rsa.crt());
+        REQUIRE(rsa.decrypt(ct, kp.private_key) == pt);
+
+        crypto::modern::asymmetric::RSA plain;
+        plain.setCRT(false);
+        REQUIRE(plain.decrypt(ct, kp.private_key) == pt);
+
+        // Fields are [len][value]: keep n, skip e, keep d
+        auto field = [&](size_t& off) {
+            size_t len = (size_t{kp.private_key[off]} << 24) | (size_t{kp.private_key[off + 1]} << 16) |
+                         (size_t{kp.private_key[off + 2]} << 8) | kp.private_key[off + 3];
+            Bytes out(kp.private_key.begin() + off, kp.private_key.begin() + off + 4 + len);
+            off += 4 + len;
+            return out;
+        };
+        size_t off = 0;
+        Bytes legacy = field(off);
+        field(off);
+        Bytes d = field(off);
+        legacy.insert(legacy.end(), d.begin(), d.end());
+        REQUIRE(rsa.decrypt(ct, legacy) == pt);
+
+        // The blinding pair is squared per call and redrawn every 32; results never change
+        for (int i = 0; i < 40; ++i) REQUIRE(rsa.decrypt(ct, kp.private_key) == pt);
+
+        Bytes truncated(kp.private_key.begin(), kp.private_key.end() - 1);
+        REQUIRE_THROWS_AS(rsa.decrypt(ct, truncated), std::invalid_argument);
+    }
+
+    SECTION("One instance shared across threads and keys") {
+        auto other = rsa.generateKeyPair(512);
+        Bytes pt = utils::fromHex("5eed");
+        Bytes ct = rsa.encrypt(pt, kp.public_key);
+        Bytes otherCt = rsa.encrypt(pt, other.public_key);
+
+        // Each key keeps its own blinding pair while the threads alternate between them
+        std::atomic<int> wrong{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < 20; ++i) {
+                    try {
+                        if (rsa.decrypt(ct, kp.private_key) != pt) ++wrong;
+                        if (rsa.decrypt(otherCt, other.private_key) != pt) ++wrong;
+                    } catch (const std::exception&) {
+                        ++wrong;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        REQUIRE(wrong == 0);
+    }
+
+    SECTION("Malformed input") {
+        Bytes ct = rsa.encrypt({ 0x42 }, kp.public_key);
+        REQUIRE_THROWS_AS(rsa.decrypt(Bytes(ct.begin(), ct.end() - 1), kp.private_key), std::invalid_argument);
+        REQUIRE_THROWS_AS(rsa.decrypt(ct, Bytes(kp.private_key.begin(), kp.private_key.begin() + 10)), std::invalid_argument);
+        REQUIRE_THROWS_AS(rsa.generateKeyPair(128), std::invalid_argument);
+        REQUIRE_THROWS_AS(rsa.generateKeyPair(1023), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Modern RSA: Bignum arithmetic matches OpenSSL BN", "[modern][rsa]") {
+    using crypto::modern::asymmetric::BigInt;
+
+    std::mt19937 rng(2048);
+    auto random = [&](size_t n) {
+        Bytes b(n);
+        for (auto& x : b) x = static_cast<uint8_t>(rng());
+        return b;
+    };
+
+    BN_CTX* ctx = BN_CTX_new();
+    auto toBN = [](const Bytes& b) { return BN_bin2bn(b.data(), static_cast<int>(b.size()), nullptr); };
+    auto fromBN = [](const BIGNUM* bn) {
+        Bytes b(BN_num_bytes(bn));
+        BN_bn2bin(bn, b.data());
+        return b;
+    };
+
+    SECTION("Division, multiplication and inverses") {
+        for (int i = 0; i < 200; ++i) {
+            Bytes a = random(1 + rng() % 96), b = random(1 + rng() % 64);
+            if (i % 4 == 0) b[0] = 0x80;      // normalized divisor
+            if (i % 4 == 1) b[0] = 0x01;      // worst-case shift
+            BigInt x = BigInt::fromBytes(a), y = BigInt::fromBytes(b);
+            if (y.isZero()) continue;
+
+            BIGNUM *bx = toBN(a), *by = toBN(b), *q = BN_new(), *r = BN_new(), *prod = BN_new();
+            REQUIRE(BN_div(q, r, bx, by, ctx) == 1);
+            REQUIRE(BN_mul(prod, bx, by, ctx) == 1);
+
+            BigInt bq, br;
+            BigInt::divMod(x, y, bq, br);
+            REQUIRE(bq.toBytes() == fromBN(q));
+            REQUIRE(br.toBytes() == fromBN(r));
+            REQUIRE((x * y).toBytes() == fromBN(prod));
+            REQUIRE(bq * y + br == x);
+            REQUIRE(((x << 37) >> 37) == x);
+
+            if (BigInt::gcd(x, y) == BigInt(1) && y > BigInt(1)) {
+                REQUIRE((BigInt::modInverse(x, y) * x) % y == BigInt(1));
+            }
+            BN_free(bx); BN_free(by); BN_free(q); BN_free(r); BN_free(prod);
+        }
+        REQUIRE_THROWS_AS(BigInt(5) / BigInt(), std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInt(5) - BigInt(6), std::invalid_argument);
+    }
+
+    SECTION("Montgomery modPow") {
+        for (size_t bytes : { size_t{4}, size_t{17}, size_t{128}, size_t{256} }) {
+            Bytes m = random(bytes), base = random(bytes + 3), exp = random(bytes);
+            m.back() |= 0x01;
+            m[0] |= 0x80;
+
+            BIGNUM *bm = toBN(m), *bb = toBN(base), *be = toBN(exp), *r = BN_new();
+            REQUIRE(BN_mod_exp(r, bb, be, bm, ctx) == 1);
+            REQUIRE(BigInt::modPow(BigInt::fromBytes(base), BigInt::fromBytes(exp), BigInt::fromBytes(m)).toBytes() == fromBN(r));
+            BN_free(bm); BN_free(bb); BN_free(be); BN_free(r);
+        }
+    }
+
+    SECTION("Miller-Rabin") {
+        using crypto::modern::asymmetric::RSA;
+        // 2^127 - 1 (Mersenne prime), a Carmichael number and a product of two primes
+        BigInt m127 = (BigInt(1) << 127) - BigInt(1);
+        REQUIRE(RSA::isPrime(m127, 40));
+        REQUIRE_FALSE(RSA::isPrime(BigInt(561), 40));
+        REQUIRE_FALSE(RSA::isPrime(m127 * ((BigInt(1) << 89) - BigInt(1)), 40));
+        REQUIRE(RSA::isPrime(BigInt(8191), 1));
+        REQUIRE_FALSE(RSA::isPrime(BigInt(1), 1));
+    }
+
+    BN_CTX_free(ctx);
+}
+
+TEST_CASE("Modern RSA: 2048-bit keys", "[modern][rsa]") {
+    crypto::modern::asymmetric::RSA rsa;
+    auto kp = rsa.generateKeyPair(2048);
+
+    Bytes msg = utils::fromHex("00112233445566778899aabbccddeeff");
+    Bytes ct = rsa.encrypt(msg, kp.public_key);
+    REQUIRE(ct.size() == 256);
+    REQUIRE(rsa.decrypt(ct, kp.private_key) == msg);
 }
 
 // ============================================================
@@ -0,0 +1,682 @@
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <span>
+#include <optional>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <boost/asio.hpp>
+
+#include "net/protocol/Message.h"
+#include "net/protocol/SharedFrame.h"
+#include "net/server/SessionManager.h"
+#include "net/server/sessions/WriteQueue.h"
+#include "net/server/sessions/PlainSession.h"
+#include "net/server/ServerController.h"
+#include "net/server/Router.h"
+#include "net/client/Client.h"
+#include "net/client/transport/PlainTransport.h"
+
+using namespace net::protocol;
+
+namespace {
+    // Session double that records what would have been written to the wire
+    class RecordingSession : public net::core::ISession {
+    public:
+        explicit RecordingSession(BodyEncoding encoding = BodyEncoding::Json) : mEncoding(encoding) {}
+
+        void start() override {}
+        void onStart(const SessionCallback&) override {}
+        void close() override {}
+        void onClose(const SessionCallback&) override {}
+
+        void send(const Message& message) override { frames.emplace_back(message, mEncoding); }
+        void send(const SharedFrame& frame) override { frames.push_back(frame); }
+        void onMessage(const MessageCallback&) override {}
+        void onError(const ErrorCallback&) override {}
+
+        void setUid(uint32_t uid) override { mUid = uid; }
+        uint32_t getUid() const override { return mUid; }
+        BodyEncoding getEncoding() const override { return mEncoding; }
+        net::core::SessionStats stats() const override { return {}; }
+
+        std::vector<SharedFrame> frames;
+
+    private:
+        uint32_t mUid{};
+        BodyEncoding mEncoding;
+    };
+
+    // Asks the OS for a currently unused loopback port
+    uint16_t freePort() {
+        boost::asio::io_context io;
+        boost::asio::ip::tcp::acceptor probe(io, {boost::asio::ip::address_v4::loopback(), 0});
+        return probe.local_endpoint().port();
+    }
+
+    // Blocking request/response over a raw socket
+    Message roundtrip(boost::asio::ip::tcp::socket& sock, const Message& request) {
+        boost::asio::write(sock, boost::asio::buffer(request.encode()));
+
+        std::array<uint8_t, kHeaderSize> header{};
+        boost::asio::read(sock, boost::asio::buffer(header));
+        uint32_t len = (uint32_t(header[1]) << 24) | (uint32_t(header[2]) << 16) |
+                       (uint32_t(header[3]) << 8)  |  uint32_t(header[4]);
+
+        std::vector<uint8_t> body(len);
+        boost::asio::read(sock, boost::asio::buffer(body));
+        return Message::decode(Message::typeFromByte(header[0]), body, Message::encodingFromByte(header[0]));
+    }
+}
+
+// ============================================================
+// PROTOCOL: FRAME ENCODING
+// ============================================================
+TEST_CASE("Protocol Message: Body Encoding Roundtrip", "[net][protocol]") {
+    Message original = Message::makeRequest(42, "send_public", {{"text", "hello"}, {"to", {1, 2, 3}}});
+
+    BodyEncoding encodings[] = { BodyEncoding::Json, BodyEncoding::MessagePack, BodyEncoding::Cbor };
+
+    for (auto encoding : encodings) {
+        DYNAMIC_SECTION("Encoding: " << static_cast<int>(encoding)) {
+            std::vector<uint8_t> frame = original.encode(encoding);
+            REQUIRE(frame.size() > kHeaderSize);
+
+            // Header carries both the message type and the body encoding
+            REQUIRE(Message::typeFromByte(frame[0]) == MessageType::Request);
+            REQUIRE(Message::encodingFromByte(frame[0]) == encoding);
+
+            // Length field is big-endian and covers only the body
+            uint32_t len = (uint32_t(frame[1]) << 24) | (uint32_t(frame[2]) << 16) |
+                           (uint32_t(frame[3]) << 8)  |  uint32_t(frame[4]);
+            REQUIRE(len == frame.size() - kHeaderSize);
+
+            std::vector<uint8_t> body(frame.begin() + kHeaderSize, frame.end());
+            Message decoded = Message::decode(MessageType::Request, body, encoding);
+            REQUIRE(decoded.j == original.j);
+        }
+    }
+
+    SECTION("Legacy JSON type byte is still understood") {
+        // Peers that predate body encodings send a bare MessageType byte
+        REQUIRE(Message::typeFromByte(0x02) == MessageType::Push);
+        REQUIRE(Message::encodingFromByte(0x02) == BodyEncoding::Json);
+    }
+
+    SECTION("JSON fallback is compact") {
+        std::vector<uint8_t> frame = original.encode(BodyEncoding::Json);
+        std::string body(frame.begin() + kHeaderSize, frame.end());
+        REQUIRE(body.find('\n') == std::string::npos);
+        REQUIRE(body.find("  ") == std::string::npos);
+    }
+
+    SECTION("Malformed payloads are rejected") {
+        std::vector<uint8_t> empty;
+        std::vector<uint8_t> truncated = {'{', 'x'};
+        REQUIRE_THROWS(Message::decode(MessageType::Request, empty, BodyEncoding::Json));
+        REQUIRE_THROWS(Message::decode(MessageType::Request, truncated, BodyEncoding::Json));
+        REQUIRE_THROWS(Message::decode(MessageType::Request, truncated, static_cast<BodyEncoding>(9)));
+    }
+
+    SECTION("Decoding from a view into a larger receive buffer") {
+        // Sessions parse in place: header and body share one buffer
+        std::vector<uint8_t> frame = original.encode(BodyEncoding::MessagePack);
+        auto payload = std::span<const uint8_t>(frame).subspan(kHeaderSize);
+
+        Message decoded = Message::decode(Message::typeFromByte(frame[0]), payload, Message::encodingFromByte(frame[0]));
+        REQUIRE(decoded.j == original.j);
+    }
+}
+
+// ============================================================
+// SESSION MANAGER: FAN-OUT
+// ============================================================
+TEST_CASE("SessionManager: Broadcast encodes once per body encoding", "[net][server]") {
+    net::server::SessionManager sessions;
+
+    auto a = std::make_shared<RecordingSession>(BodyEncoding::Json);
+    auto b = std::make_shared<RecordingSession>(BodyEncoding::Json);
+    auto c = std::make_shared<RecordingSession>(BodyEncoding::MessagePack);
+    uint32_t uidA = sessions.add(a);
+    uint32_t uidB = sessions.add(b);
+    uint32_t uidC = sessions.add(c);
+
+    Message push = Message::makePush({{"event", "public_message"}, {"text", "hi"}});
+
+    SECTION("broadcast shares the same bytes between sessions") {
+        sessions.broadcast(push);
+
+        REQUIRE(a->frames.size() == 1);
+        REQUIRE(b->frames.size() == 1);
+        REQUIRE(c->frames.size() == 1);
+
+        REQUIRE(a->frames[0].data() == b->frames[0].data());
+        REQUIRE(a->frames[0].data() != c->frames[0].data());
+        REQUIRE(a->frames[0].encoding() == BodyEncoding::Json);
+        REQUIRE(c->frames[0].encoding() == BodyEncoding::MessagePack);
+    }
+
+    SECTION("sendTo only reaches the listed sessions") {
+        sessions.sendTo({uidA, uidC}, push);
+
+        REQUIRE(a->frames.size() == 1);
+        REQUIRE(b->frames.empty());
+        REQUIRE(c->frames.size() == 1);
+    }
+
+    SECTION("shared frames decode back to the original message") {
+        sessions.sendTo({uidB}, push);
+        auto bytes = b->frames[0].bytes();
+
+        Message decoded = Message::decode(Message::typeFromByte(bytes[0]), bytes.subspan(kHeaderSize), b->frames[0].encoding());
+        REQUIRE(decoded.j == push.j);
+    }
+}
+
+TEST_CASE("SessionManager: Lock-free readers alongside writers", "[net][server]") {
+    net::server::SessionManager sessions;
+
+    // Spread over every shard
+    std::vector<uint32_t> stable;
+    for (int i = 0; i < 64; ++i) stable.push_back(sessions.add(std::make_shared<RecordingSession>()));
+    sessions.setName(stable[0], "alice");
+
+    REQUIRE(sessions.getCount() == 64);
+    REQUIRE(sessions.getName(stable[0]) == "alice");
+    REQUIRE(sessions.getName(stable[1]) == "guest");
+    REQUIRE(sessions.getName(999999) == "Unknown");
+    REQUIRE(sessions.get(999999) == nullptr);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 2000; ++i) {
+            uint32_t uid = sessions.add(std::make_shared<RecordingSession>());
+            sessions.setName(uid, "churn");
+            sessions.remove(uid);
+        }
+        done = true;
+    });
+
+    // Entries that exist for the whole run are always visible to readers
+    bool consistent = true;
+    while (!done) {
+        for (uint32_t uid : stable) consistent &= sessions.get(uid) != nullptr;
+        consistent &= sessions.getName(stable[0]) == "alice";
+        consistent &= sessions.getCount() >= stable.size();
+    }
+    writer.join();
+
+    REQUIRE(consistent);
+    REQUIRE(sessions.getCount() == 64);
+
+    auto ids = sessions.listIds();
+    std::sort(ids.begin(), ids.end());
+    REQUIRE(ids == stable);
+}
+
+TEST_CASE("Roster: Cached full list and deltas since a version", "[net][server]") {
+    net::server::SessionManager sessions;
+    const auto& roster = sessions.roster();
+
+    uint32_t a = sessions.add(std::make_shared<RecordingSession>());
+    uint32_t b = sessions.add(std::make_shared<RecordingSession>());
+    sessions.setName(a, "alice");
+
+    auto full = roster.list()->value();
+    uint64_t v1 = full["version"];
+    REQUIRE(full["clients"].size() == 2);
+    REQUIRE(full["clients"][0] == json{{"uid", a}, {"name", "alice"}});
+    REQUIRE(full["clients"][1] == json{{"uid", b}, {"name", "guest"}});
+
+    SECTION("The full list is built and encoded once per version") {
+        auto first = roster.snapshot();
+        REQUIRE(roster.snapshot() == first);
+        REQUIRE(roster.list() == first->list);
+        REQUIRE(first->list->bytes(BodyEncoding::Cbor).data() == first->list->bytes(BodyEncoding::Cbor).data());
+
+        sessions.setName(b, "bob");
+        REQUIRE(roster.snapshot() != first);
+        REQUIRE(roster.snapshot()->version == roster.version());
+    }
+
+    SECTION("Deltas carry only what changed") {
+        REQUIRE(roster.list(v1)->value() == json{{"version", v1}, {"since", v1}, {"joined", json::array()}, {"left", json::array()}});
+
+        uint32_t c = sessions.add(std::make_shared<RecordingSession>());
+        sessions.setName(c, "carol");
+        sessions.remove(b);
+
+        auto delta = roster.list(v1)->value();
+        REQUIRE_FALSE(delta.contains("clients"));
+        REQUIRE(delta["version"] == roster.version());
+        REQUIRE(delta["joined"] == json::array({{{"uid", c}, {"name", "carol"}}}));
+        REQUIRE(delta["left"] == json::array({b}));
+    }
+
+    SECTION("Unknown or expired versions fall back to the full list") {
+        REQUIRE(roster.list(v1 + 100)->value().contains("clients"));
+
+        for (size_t i = 0; i <= net::server::Roster::kMaxChanges; ++i) sessions.setName(a, "a" + std::to_string(i));
+        auto fallback = roster.list(v1)->value();
+        REQUIRE(fallback.contains("clients"));
+        REQUIRE(fallback["clients"].size() == 2);
+    }
+}
+
+TEST_CASE("Router: Encoded results are spliced into responses", "[net][server]") {
+    using net::protocol::EncodedResult;
+
+    auto shared = std::make_shared<const EncodedResult>(json{{"version", 7}, {"clients", json::array({{{"uid", 1}, {"name", "alice"}}})}});
+    net::server::Router router;
+    router.addEncoded("client_list", [&](const json&, uint32_t) { return shared; });
+    router.addEncoded("broken", [](const json&, uint32_t) { return std::shared_ptr<const EncodedResult>(); });
+
+    for (auto encoding : { BodyEncoding::Json, BodyEncoding::MessagePack, BodyEncoding::Cbor }) {
+        DYNAMIC_SECTION("Encoding " << static_cast<int>(encoding)) {
+            Message request = Message::makeRequest(42, "client_list", json::object());
+            auto frame = router.respond(request, 1, encoding);
+
+            auto payload = frame.bytes().subspan(net::protocol::kHeaderSize);
+            Message decoded = Message::decode(MessageType::Response, payload, encoding);
+            REQUIRE(frame.encoding() == encoding);
+            REQUIRE(decoded.j["id"] == 42);
+            REQUIRE(decoded.j["result"] == shared->value());
+
+            // Byte-identical to encoding the whole response
+            Message expected = router.handle(request, 1);
+            expected.j["timestamp"] = decoded.j["timestamp"];
+            auto bytes = expected.encode(encoding);
+            REQUIRE(std::equal(bytes.begin(), bytes.end(), frame.bytes().begin(), frame.bytes().end()));
+
+            Message error = Message::decode(MessageType::Response,
+                router.respond(Message::makeRequest(43, "broken", json::object()), 1, encoding).bytes().subspan(net::protocol::kHeaderSize),
+                encoding);
+            REQUIRE(error.j["error"]["code"] == -32000);
+        }
+    }
+}
+
+// ============================================================
+// SESSIONS: OUTGOING WRITE QUEUE
+// ============================================================
+TEST_CASE("WriteQueue: Single outstanding write with batched flushes", "[net][server]") {
+    net::server::sessions::WriteQueue queue;
+    SharedFrame f1(Message::makePush({{"n", 1}}), BodyEncoding::Json);
+    SharedFrame f2(Message::makePush({{"n", 2}}), BodyEncoding::Json);
+    SharedFrame f3(Message::makePush({{"n", 3}}), BodyEncoding::Json);
+
+    REQUIRE(queue.push(f1) == true);   // idle -> caller starts the write
+    REQUIRE(queue.beginFlush().size() == 1);
+
+    REQUIRE(queue.push(f2) == false);  // write outstanding -> just queue
+    REQUIRE(queue.push(f3) == false);
+    REQUIRE(queue.stats().queuedFrames == 3);
+    REQUIRE(queue.stats().bytesPending == f1.size() + f2.size() + f3.size());
+
+    REQUIRE(queue.completeFlush() == true); // more pending -> flush again
+    const auto& batch = queue.beginFlush();
+    REQUIRE(batch.size() == 2);            // both queued frames in one gather write
+    REQUIRE(batch[0].data() == f2.data());
+    REQUIRE(batch[1].data() == f3.data());
+
+    REQUIRE(queue.completeFlush() == false);
+    auto stats = queue.stats();
+    REQUIRE(stats.queuedFrames == 0);
+    REQUIRE(stats.bytesPending == 0);
+    REQUIRE(stats.framesSent == 3);
+    REQUIRE(stats.bytesSent == f1.size() + f2.size() + f3.size());
+
+    REQUIRE(queue.push(f1) == true);   // idle again
+}
+
+TEST_CASE("PlainSession: Concurrent sends arrive whole and in order", "[net][server]") {
+    using boost::asio::ip::tcp;
+    boost::asio::io_context io;
+
+    tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+    tcp::socket peer(io);
+    peer.connect(acceptor.local_endpoint());
+    auto session = std::make_shared<net::server::sessions::PlainSession>(acceptor.accept());
+
+    constexpr int kFrames = 200;
+    auto work = boost::asio::make_work_guard(io);
+    std::thread producer([&] {
+        for (int i = 0; i < kFrames; ++i) session->send(Message::makePush({{"seq", i}}));
+    });
+    std::thread runner([&] { io.run(); });
+
+    for (int i = 0; i < kFrames; ++i) {
+        std::array<uint8_t, kHeaderSize> header{};
+        boost::asio::read(peer, boost::asio::buffer(header));
+        uint32_t len = (uint32_t(header[1]) << 24) | (uint32_t(header[2]) << 16) |
+                       (uint32_t(header[3]) << 8)  |  uint32_t(header[4]);
+
+        std::vector<uint8_t> body(len);
+        boost::asio::read(peer, boost::asio::buffer(body));
+        Message msg = Message::decode(Message::typeFromByte(header[0]), body, Message::encodingFromByte(header[0]));
+        REQUIRE(msg.j["push"]["seq"] == i);
+    }
+
+    producer.join();
+
+    // The last completion handler may still be on its way after the peer has read everything
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (session->stats().framesSent < kFrames && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    io.stop();
+    runner.join();
+
+    REQUIRE(session->stats().framesSent == kFrames);
+    REQUIRE(session->stats().queuedFrames == 0);
+}
+
+// ============================================================
+// SERVER CONTROLLER: WORKER POOL
+// ============================================================
+TEST_CASE("ServerController: Serves requests on a multi-threaded pool", "[net][server]") {
+    using boost::asio::ip::tcp;
+    using net::server::ThreadingModel;
+
+    auto router = std::make_shared<net::server::Router>();
+    auto sessions = std::make_shared<net::server::SessionManager>();
+    router->add("ping", [](const json&, uint32_t) -> json { return {{"msg", "pong"}}; });
+
+    ThreadingModel models[] = { ThreadingModel::SharedContext, ThreadingModel::ContextPerThread };
+
+    for (auto model : models) for (bool reusePort : {false, true}) {
+        DYNAMIC_SECTION("Threading model: " << static_cast<int>(model) << ", SO_REUSEPORT: " << reusePort) {
+            net::server::ServerController controller(router, sessions);
+
+            net::server::ServerConfig cfg;
+            cfg.port = freePort();
+            cfg.workerThreads = 4;
+            cfg.threading = model;
+            cfg.reusePort = reusePort;
+            REQUIRE(controller.start(cfg));
+
+            boost::asio::io_context io;
+            std::vector<tcp::socket> clients;
+            for (int i = 0; i < 8; ++i) {
+                clients.emplace_back(io);
+                clients.back().connect({boost::asio::ip::address_v4::loopback(), cfg.port});
+            }
+
+            for (uint32_t round = 1; round <= 3; ++round) {
+                for (auto& client : clients) {
+                    Message response = roundtrip(client, Message::makeRequest(round, "ping", json::object()));
+                    REQUIRE(response.type == MessageType::Response);
+                    REQUIRE(response.j["id"] == round);
+                    REQUIRE(response.j["result"]["msg"] == "pong");
+                }
+            }
+
+            // Every session was counted from accept to start
+            auto stats = controller.stats(cfg.port);
+            REQUIRE(stats.accept.accepted == clients.size());
+            REQUIRE(stats.accept.acceptErrors == 0);
+            REQUIRE(stats.sessionStart.count == clients.size());
+            REQUIRE(stats.sessionStart.max >= stats.sessionStart.average);
+            REQUIRE(stats.tlsHandshake.count == 0);
+
+            controller.stopAll();
+            REQUIRE(controller.stats(cfg.port).accept.accepted == 0);
+        }
+    }
+}
+
+TEST_CASE("Server: Listening sockets", "[net][server]") {
+    using boost::asio::ip::tcp;
+    boost::asio::io_context io;
+
+    SECTION("SO_REUSEPORT opens one acceptor per context on the same port") {
+        boost::asio::io_context io2;
+        net::server::Server::ListenOptions options;
+        options.reusePort = true;
+        options.backlog = 64;
+
+        net::server::Server server({std::ref(io), std::ref(io2), std::ref(io2)}, options);
+        REQUIRE(server.acceptorCount() == 3);
+        REQUIRE(server.port() != 0);
+
+        std::atomic<int> accepted{0};
+        std::vector<tcp::socket> kept;
+        server.onConnect([&](tcp::socket sock) { kept.push_back(std::move(sock)); ++accepted; });
+        server.start();
+
+        std::vector<tcp::socket> clients;
+        for (int i = 0; i < 16; ++i) {
+            clients.emplace_back(io);
+            clients.back().connect({boost::asio::ip::address_v4::loopback(), server.port()});
+        }
+
+        // Single thread drives both contexts so the callback needs no locking
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (accepted < 16 && std::chrono::steady_clock::now() < deadline) {
+            io.poll();
+            io2.poll();
+        }
+        REQUIRE(accepted == 16);
+        server.stop();
+    }
+
+    SECTION("Pending connections are drained in batches") {
+        net::server::Server server(io, 0);
+
+        int accepted = 0;
+        std::vector<tcp::socket> kept;
+        server.onConnect([&](tcp::socket sock) { kept.push_back(std::move(sock)); ++accepted; });
+
+        // Connections wait in the kernel's accept queue until the server starts
+        std::vector<tcp::socket> clients;
+        for (int i = 0; i < 10; ++i) {
+            clients.emplace_back(io);
+            clients.back().connect({boost::asio::ip::address_v4::loopback(), server.port()});
+        }
+        server.start();
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (accepted < 10 && std::chrono::steady_clock::now() < deadline) io.poll();
+        REQUIRE(accepted == 10);
+
+        auto stats = server.stats();
+        REQUIRE(stats.accepted == 10);
+        REQUIRE(stats.acceptErrors == 0);
+        REQUIRE(stats.wakeups < stats.accepted);
+    }
+
+    SECTION("Without SO_REUSEPORT only the first context gets an acceptor") {
+        net::server::Server server({std::ref(io), std::ref(io)}, {});
+        REQUIRE(server.acceptorCount() == 1);
+    }
+
+    SECTION("Dual-stack socket accepts IPv4 clients") {
+        net::server::Server::ListenOptions options;
+        options.family = net::server::AddressFamily::DualStack;
+
+        std::unique_ptr<net::server::Server> server;
+        try {
+            server = std::make_unique<net::server::Server>(net::server::Server::ContextList{std::ref(io)}, options);
+        } catch (const boost::system::system_error&) {
+            SKIP("IPv6 is not available");
+        }
+
+        std::optional<boost::asio::ip::address> peer;
+        server->onConnect([&](tcp::socket sock) { peer = sock.remote_endpoint().address(); });
+        server->start();
+
+        tcp::socket client(io);
+        client.connect({boost::asio::ip::address_v4::loopback(), server->port()});
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!peer && std::chrono::steady_clock::now() < deadline) io.poll();
+
+        REQUIRE(peer.has_value());
+        REQUIRE(peer->is_v6());                         // seen as an IPv4-mapped IPv6 address
+        REQUIRE(peer->to_v6().is_v4_mapped());
+    }
+}
+
+// ============================================================
+// CLIENT: PIPELINED RPC
+// ============================================================
+TEST_CASE("Client: Pipelined requests with a bounded window", "[net][client]") {
+    using boost::asio::ip::tcp;
+    using net::client::Client;
+
+    auto makeClient = [](boost::asio::io_context& io, size_t window) {
+        auto client = std::make_unique<Client>(io, std::make_unique<net::client::transport::PlainTransport>(io));
+        client->configurePipeline({window, std::chrono::milliseconds(0)});
+        return client;
+    };
+
+    // Waits on the test thread for callbacks running on the client's io thread
+    auto waitFor = [](const std::function<bool()>& done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return done();
+    };
+
+    SECTION("Responses are matched to pipelined requests") {
+        auto router = std::make_shared<net::server::Router>();
+        router->add("echo", [](const json& p, uint32_t) -> json { return p; });
+        net::server::ServerController controller(router, std::make_shared<net::server::SessionManager>());
+
+        net::server::ServerConfig cfg;
+        cfg.port = freePort();
+        REQUIRE(controller.start(cfg));
+
+        boost::asio::io_context io;
+        auto client = makeClient(io, 16);
+        REQUIRE(client->connect("127.0.0.1", cfg.port));
+
+        constexpr int kRequests = 200;
+        std::atomic<int> matched{0};
+        std::vector<Client::BatchCall> batch;
+        for (int i = 0; i < kRequests; ++i) {
+            REQUIRE(waitFor([&] { return client->inFlight() < 16; }));
+            client->call("echo", {{"n", i}}, [&matched, i](const json& r) { if (r.value("n", -1) == i) ++matched; });
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            batch.push_back({"echo", {{"n", 1000 + i}}, [&matched, i](const json& r) { if (r.value("n", -1) == 1000 + i) ++matched; }, nullptr});
+        }
+        REQUIRE(waitFor([&] { return client->inFlight() == 0; }));
+        auto ids = client->callBatch(std::move(batch));
+        REQUIRE(ids.size() == 3);
+        REQUIRE(ids[0] != 0);
+        REQUIRE(ids[1] == ids[0] + 1);
+
+        REQUIRE(waitFor([&] { return matched == kRequests + 3; }));
+        REQUIRE(client->request("echo", {{"sync", true}})["sync"] == true);
+
+        client->close();
+        controller.stopAll();
+    }
+
+    SECTION("Blocking requests wait for a slot instead of failing") {
+        auto router = std::make_shared<net::server::Router>();
+        router->add("echo", [](const json& p, uint32_t) -> json { return p; });
+        router->add("fail", [](const json&, uint32_t) -> json { throw std::runtime_error("nope"); });
+        net::server::ServerController controller(router, std::make_shared<net::server::SessionManager>());
+
+        net::server::ServerConfig cfg;
+        cfg.port = freePort();
+        REQUIRE(controller.start(cfg));
+
+        boost::asio::io_context io;
+        auto client = makeClient(io, 1);
+        REQUIRE(client->connect("127.0.0.1", cfg.port));
+
+        // One slot shared by several blocking callers: each one must get its own response
+        std::atomic<int> ok{0};
+        std::vector<std::thread> callers;
+        for (int t = 0; t < 4; ++t) {
+            callers.emplace_back([&, t] {
+                for (int i = 0; i < 25; ++i) {
+                    if (client->request("echo", {{"n", t * 100 + i}}).value("n", -1) == t * 100 + i) ++ok;
+                }
+            });
+        }
+        for (auto& caller : callers) caller.join();
+        REQUIRE(ok == 100);
+
+        // Server errors go to onError, never to the result callback
+        std::atomic<int> results{0}, errors{0};
+        client->requestAsync("fail", json::object(),
+            [&](const json&) { ++results; },
+            [&](int code, const std::string&) { if (code == -32000) ++errors; });
+        REQUIRE(waitFor([&] { return errors == 1; }));
+        REQUIRE(results == 0);
+
+        client->close();
+        controller.stopAll();
+    }
+
+    SECTION("Window, cancellation and timeouts against a silent server") {
+        boost::asio::io_context serverIo;
+        tcp::acceptor acceptor(serverIo, {boost::asio::ip::address_v4::loopback(), 0});
+
+        boost::asio::io_context io;
+        auto client = makeClient(io, 4);
+        REQUIRE(client->connect("127.0.0.1", acceptor.local_endpoint().port()));
+        tcp::socket peer = acceptor.accept();
+
+        std::mutex mutex;
+        std::vector<int> errors;
+        std::atomic<int> results{0};
+        auto onResult = [&](const json&) { ++results; };
+        auto record = [&](int code, const std::string&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            errors.push_back(code);
+        };
+        auto count = [&](int code) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return std::count(errors.begin(), errors.end(), code);
+        };
+
+        std::vector<uint32_t> ids;
+        for (int i = 0; i < 4; ++i) ids.push_back(client->call("ping", json::object(), onResult, record));
+        REQUIRE(client->inFlight() == 4);
+
+        // Window is full: rejected right away instead of queued
+        REQUIRE(client->call("ping", json::object(), onResult, record) == 0);
+        REQUIRE(waitFor([&] { return count(Client::kErrorWindowFull) == 1; }));
+
+        // The legacy overload gets local failures as a {code, message} result
+        std::atomic<int> legacyCode{0};
+        client->requestAsync("ping", json::object(), [&](const json& r) { legacyCode = r.value("code", 0); });
+        REQUIRE(waitFor([&] { return legacyCode == Client::kErrorWindowFull; }));
+
+        REQUIRE(client->cancel(ids[0]));
+        REQUIRE_FALSE(client->cancel(ids[0]));
+        REQUIRE(client->inFlight() == 3);
+        REQUIRE(waitFor([&] { return count(Client::kErrorCancelled) == 1; }));
+
+        REQUIRE(client->call("ping", json::object(), onResult, record, {std::chrono::milliseconds(30)}) != 0);
+        REQUIRE(waitFor([&] { return count(Client::kErrorTimeout) == 1; }));
+        REQUIRE(client->inFlight() == 3);
+
+        // The server saw every request that got a slot (4 + 1 timed out)
+        for (int i = 0; i < 5; ++i) {
+            std::array<uint8_t, kHeaderSize> header{};
+            boost::asio::read(peer, boost::asio::buffer(header));
+            uint32_t len = (uint32_t(header[1]) << 24) | (uint32_t(header[2]) << 16) |
+                           (uint32_t(header[3]) << 8)  |  uint32_t(header[4]);
+            std::vector<uint8_t> body(len);
+            boost::asio::read(peer, boost::asio::buffer(body));
+            REQUIRE(Message::decode(Message::typeFromByte(header[0]), body).j["method"] == "ping");
+        }
+
+        // Closing fails whatever is still pending
+        client->close();
+        REQUIRE(count(Client::kErrorClosed) == 3);
+        REQUIRE(client->inFlight() == 0);
+        REQUIRE(results == 0);
+    }
+}
@@ -1,11 +1,59 @@
 #include <catch2/catch_all.hpp>
+#include <iostream>
+#include <string>
+#include <span>
+#include <utility>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+
 #include "crypto/modern/symmetric/block/AES.h"
+#include "crypto/modern/symmetric/block/AESNI.h"
+#include "crypto/modern/symmetric/block/AESBitsliced.h"
 #include "crypto/modern/symmetric/block/DES.h"
+#include "crypto/modern/symmetric/block/DESKeySearch.h"
+#include "crypto/modern/symmetric/block/TripleDES.h"
+#include "crypto/modern/asymmetric/RSA.h"
+#include "crypto/modern/symmetric/mode/CBC.h"
+#include "crypto/modern/symmetric/mode/CTR.h"
+#include "crypto/modern/symmetric/mode/GCM.h"
 #include "crypto/standard/openssl/AESCBC.h"
+#include "crypto/standard/openssl/AESGCM.h"
+#include "crypto/standard/openssl/ChaCha20Poly1305.h"
 #include "crypto/standard/openssl/DES.h"
+#include "crypto/standard/openssl/RSA.h"
+#include "crypto/standard/openssl/RSAKey.h"
+#include "crypto/standard/openssl/RSAKeyPool.h"
+#include "net/protocol/Message.h"
+#include "net/server/Router.h"
+#include "net/server/ServerController.h"
+#include "net/server/SessionManager.h"
 
 using namespace crypto::core;
 
+namespace {
+    // Runs `pass` (which processes `bytes` bytes) until ~200 ms have elapsed and returns MB/s
+    template <typename Fn>
+    double megabytesPerSecond(size_t bytes, Fn&& pass) {
+        using clock = std::chrono::steady_clock;
+        pass(); // warm-up
+
+        size_t processed = 0;
+        auto begin = clock::now();
+        std::chrono::duration<double> elapsed{};
+        do {
+            pass();
+            processed += bytes;
+            elapsed = clock::now() - begin;
+        } while (elapsed.count() < 0.2);
+
+        return processed / elapsed.count() / (1024.0 * 1024.0);
+    }
+}
+
 TEST_CASE("Throughput Benchmark: Manual vs Library", "[benchmark]") {
     Bytes key8(8, 0x01);
     Bytes key16(16, 0x01);
@@ -25,10 +73,15 @@ TEST_CASE("Throughput Benchmark: Manual vs Library", "[benchmark]") {
         return manualDes.encryptBlock(block8, out);
     };
 
-    BENCHMARK("OpenSSL DES Encrypt (includes context init)") {
+    BENCHMARK("OpenSSL DES-CBC Encrypt (cached context)") {
         return standardDes.encrypt(block8);
     };
 
+    Bytes desOut(crypto::standard::openssl::DES::ciphertextSize(block8.size()));
+    BENCHMARK("OpenSSL DES-CBC Encrypt (caller buffer)") {
+        return standardDes.encrypt(block8, desOut);
+    };
+
     // --- AES Performance ---
     crypto::modern::block::symmetric::AES manualAes(16);
     manualAes.setKey(key16);
@@ -36,4 +89,516 @@ TEST_CASE("Throughput Benchmark: Manual vs Library", "[benchmark]") {
     BENCHMARK("Manual AES-128 Block Encrypt") {
         return manualAes.encryptBlock(block16, out);
     };
-}
\ No newline at end of file
+}
+
+TEST_CASE("Throughput Benchmark: AES Engines", "[benchmark]") {
+    using crypto::modern::block::symmetric::AES;
+
+    constexpr size_t kBufferSize = 1 << 20;
+    Bytes in(16, 0x02), out(16);
+    Bytes key(16, 0x01);
+
+    const std::pair<const char*, AES::Engine> engines[] = {
+        { "reference", AES::Engine::Reference },
+        { "T-table",   AES::Engine::TTable }
+    };
+
+    std::cout << "\nAES-128 single-block throughput (1 MB per pass):\n";
+    for (const auto& [name, engine] : engines) {
+        AES aes(16, engine);
+        aes.setKey(key);
+
+        double enc = megabytesPerSecond(kBufferSize, [&] {
+            for (size_t i = 0; i < kBufferSize / 16; ++i) aes.encryptBlock(in, out);
+        });
+        double dec = megabytesPerSecond(kBufferSize, [&] {
+            for (size_t i = 0; i < kBufferSize / 16; ++i) aes.decryptBlock(in, out);
+        });
+
+        std::cout << "  " << name << ": encrypt " << enc << " MB/s, decrypt " << dec << " MB/s\n";
+    }
+
+    // Same engines through the span API: one call per buffer, no per-block vector handling
+    Bytes buffer(kBufferSize, 0x02);
+    std::cout << "AES-128 encryptBlocks throughput:\n";
+    for (const auto& [name, engine] : engines) {
+        AES aes(16, engine);
+        aes.setKey(key);
+
+        double enc = megabytesPerSecond(kBufferSize, [&] { aes.encryptBlocks(buffer, buffer, kBufferSize / 16); });
+        double dec = megabytesPerSecond(kBufferSize, [&] { aes.decryptBlocks(buffer, buffer, kBufferSize / 16); });
+        std::cout << "  " << name << ": encrypt " << enc << " MB/s, decrypt " << dec << " MB/s\n";
+    }
+
+    crypto::modern::block::symmetric::AESNI aesni(16);
+    aesni.setKey(key);
+
+    double enc = megabytesPerSecond(kBufferSize, [&] { aesni.encryptBlocks(buffer, buffer, kBufferSize / 16); });
+    double dec = megabytesPerSecond(kBufferSize, [&] { aesni.decryptBlocks(buffer, buffer, kBufferSize / 16); });
+    std::cout << "  AES-NI " << (aesni.usesHardware() ? "(hardware, " : "(fallback, ")
+              << crypto::modern::block::symmetric::AESNI::PARALLEL_BLOCKS << " blocks in flight): encrypt "
+              << enc << " MB/s, decrypt " << dec << " MB/s\n";
+
+    crypto::modern::block::symmetric::AESBitsliced bitsliced(16);
+    bitsliced.setKey(key);
+
+    enc = megabytesPerSecond(kBufferSize, [&] { bitsliced.encryptBlocks(buffer, buffer, kBufferSize / 16); });
+    dec = megabytesPerSecond(kBufferSize, [&] { bitsliced.decryptBlocks(buffer, buffer, kBufferSize / 16); });
+    std::cout << "  bitsliced (constant-time, " << crypto::modern::block::symmetric::AESBitsliced::BATCH_BLOCKS
+              << "-block batches): encrypt " << enc << " MB/s, decrypt " << dec << " MB/s\n";
+}
+
+TEST_CASE("Throughput Benchmark: DES Engines", "[benchmark]") {
+    using crypto::modern::block::symmetric::DES;
+    using crypto::modern::mode::symmetric::CBC;
+
+    constexpr size_t kBufferSize = 1 << 20;
+    Bytes key(8, 0x01), iv(8, 0x03);
+    Bytes buffer(kBufferSize, 0x02);
+
+    std::cout << "\nDES encryptBlocks throughput (1 MB per pass):\n";
+    for (auto [name, engine] : { std::pair{ "reference", DES::Engine::Reference }, std::pair{ "SP-box", DES::Engine::SPBox } }) {
+        DES des(engine);
+        des.setKey(key);
+
+        double enc = megabytesPerSecond(kBufferSize, [&] { des.encryptBlocks(buffer, buffer, kBufferSize / 8); });
+        double dec = megabytesPerSecond(kBufferSize, [&] { des.decryptBlocks(buffer, buffer, kBufferSize / 8); });
+        std::cout << "  " << name << ": encrypt " << enc << " MB/s, decrypt " << dec << " MB/s\n";
+    }
+
+    // CBC on both sides so the comparison with the OpenSSL wrapper is like for like
+    auto spbox = std::make_shared<DES>(DES::Engine::SPBox);
+    spbox->setKey(key);
+    CBC cbc(spbox);
+    cbc.setIV(iv);
+
+    crypto::standard::openssl::DES openssl;
+    openssl.setKey(key);
+    openssl.setIV(iv);
+    Bytes out(crypto::standard::openssl::DES::ciphertextSize(kBufferSize));
+
+    std::cout << "DES-CBC encrypt:\n";
+    std::cout << "  SP-box + modes::CBC: " << megabytesPerSecond(kBufferSize, [&] { cbc.encrypt(buffer); }) << " MB/s\n";
+    std::cout << "  OpenSSL (legacy provider): " << megabytesPerSecond(kBufferSize, [&] { openssl.encrypt(buffer, out); }) << " MB/s\n";
+
+    // 3DES: the encryptBlocks path interleaves PARALLEL_BLOCKS blocks; CBC decrypt also splits across threads
+    using crypto::modern::block::symmetric::TripleDES;
+    auto tdes = std::make_shared<TripleDES>(24);
+    tdes->setKey(Bytes(24, 0x01));
+    CBC tdesCbc(tdes);
+    tdesCbc.setIV(iv);
+    Bytes tdesCt = tdesCbc.encrypt(buffer);
+
+    std::cout << "3DES-EDE (3-key, " << TripleDES::PARALLEL_BLOCKS << " blocks in flight, "
+              << std::max(1u, std::thread::hardware_concurrency()) << " hardware threads):\n";
+    std::cout << "  encryptBlocks: " << megabytesPerSecond(kBufferSize, [&] { tdes->encryptBlocks(buffer, buffer, kBufferSize / 8); }) << " MB/s\n";
+    std::cout << "  CBC encrypt:   " << megabytesPerSecond(kBufferSize, [&] { tdesCbc.encrypt(buffer); }) << " MB/s\n";
+    std::cout << "  CBC decrypt:   " << megabytesPerSecond(kBufferSize, [&] { tdesCbc.decrypt(tdesCt); }) << " MB/s\n";
+}
+
+TEST_CASE("Throughput Benchmark: DES key search", "[benchmark]") {
+    using namespace crypto::modern::block::symmetric;
+    using clock = std::chrono::steady_clock;
+
+    Bytes pt(8, 0x02), ct;
+    DES des;
+    des.setKey(DESKeySearch::keyFromIndex(DESKeySearch::KEY_SPACE - 1));
+    des.encryptBlock(pt, ct);
+
+    auto keysPerSecond = [](uint64_t keys, auto&& fn) {
+        auto begin = clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = clock::now() - begin;
+        return static_cast<uint64_t>(keys / elapsed.count());
+    };
+
+    // Scalar baseline: setKey + encryptBlock per candidate through the Bytes API
+    constexpr uint64_t kScalarKeys = 20000;
+    uint64_t scalar = keysPerSecond(kScalarKeys, [&] {
+        DES candidate;
+        Bytes out;
+        for (uint64_t i = 0; i < kScalarKeys; ++i) {
+            candidate.setKey(DESKeySearch::keyFromIndex(i));
+            candidate.encryptBlock(pt, out);
+            if (out == ct) break;
+        }
+    });
+
+    // The key sits at the very end of the space, so every range below is searched in full
+    constexpr uint64_t kKeys = 1 << 22;
+    DESKeySearch search(pt, ct);
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "\nDES known-plaintext key search:\n";
+    std::cout << "  SP-box setKey + encryptBlock: " << scalar << " keys/sec\n";
+    std::cout << "  bitsliced, 1 thread:          " << keysPerSecond(kKeys, [&] { search.search(0, kKeys, 1); }) << " keys/sec\n";
+    std::cout << "  bitsliced, " << cores << " threads:         " << keysPerSecond(kKeys, [&] { search.search(0, kKeys, 0); }) << " keys/sec\n";
+}
+
+TEST_CASE("Throughput Benchmark: Cipher Modes", "[benchmark]") {
+    using namespace crypto::modern::mode::symmetric;
+
+    constexpr size_t kBufferSize = 4 << 20;
+    Bytes key(16, 0x01), iv(16, 0x03), data(kBufferSize, 0x02);
+
+    auto aesni = std::make_shared<crypto::modern::block::symmetric::AESNI>(16);
+    aesni->setKey(key);
+
+    CBC cbc(aesni);
+    CTR ctr(aesni);
+    GCM gcm(aesni);
+    cbc.setIV(iv);
+    ctr.setIV(iv);
+    const Bytes nonce(12, 0x03);
+    gcm.setIV(nonce);
+
+    Bytes cbcCt = cbc.encrypt(data);
+    Bytes gcmCt = gcm.encrypt(data);
+
+    crypto::standard::openssl::AESCBC openssl(crypto::standard::openssl::AESKeySize::AES_128);
+    openssl.setKey(key);
+    openssl.setIV(iv);
+
+    std::cout << "\nAES-128 modes over AES-NI (4 MB per pass, "
+              << std::max(1u, std::thread::hardware_concurrency()) << " hardware threads, GHASH "
+              << (GCM::usesCarrylessMultiply() ? "PCLMULQDQ" : "4-bit tables") << "):\n";
+    std::cout << "  CBC encrypt: " << megabytesPerSecond(kBufferSize, [&] { cbc.encrypt(data); }) << " MB/s\n";
+    std::cout << "  CBC decrypt: " << megabytesPerSecond(kBufferSize, [&] { cbc.decrypt(cbcCt); }) << " MB/s\n";
+    std::cout << "  CTR:         " << megabytesPerSecond(kBufferSize, [&] { ctr.encrypt(data); }) << " MB/s\n";
+    std::cout << "  GCM encrypt: " << megabytesPerSecond(kBufferSize, [&] { gcm.setIV(nonce); gcm.encrypt(data); }) << " MB/s\n";
+    std::cout << "  GCM decrypt: " << megabytesPerSecond(kBufferSize, [&] { gcm.decrypt(gcmCt); }) << " MB/s\n";
+    std::cout << "  OpenSSL CBC encrypt: " << megabytesPerSecond(kBufferSize, [&] { openssl.encrypt(data); }) << " MB/s\n";
+    std::cout << "  OpenSSL CBC decrypt: " << megabytesPerSecond(kBufferSize, [&] { openssl.decrypt(cbcCt); }) << " MB/s\n";
+
+    // Fixed-size chunks through the streaming API, as a file pipeline would feed it
+    constexpr size_t kChunk = 64 * 1024;
+    Bytes chunk(kChunk, 0x02);
+    double streamed = megabytesPerSecond(kBufferSize, [&] {
+        openssl.begin(crypto::standard::openssl::AESCBC::Direction::Encrypt);
+        for (size_t off = 0; off < kBufferSize; off += kChunk) openssl.update(chunk);
+        openssl.finalize();
+    });
+    std::cout << "  OpenSSL CBC encrypt (64 KiB update() chunks): " << streamed << " MB/s\n";
+}
+
+TEST_CASE("Throughput Benchmark: OpenSSL AEAD vs AES-CBC", "[benchmark]") {
+    using namespace crypto::standard::openssl;
+
+    AESCBC cbc(AESKeySize::AES_256);
+    AESGCM gcm(AESKeySize::AES_256);
+    ChaCha20Poly1305 chacha;
+
+    cbc.setKey(Bytes(32, 0x01));
+    cbc.setIV(Bytes(16, 0x02));
+    gcm.setKey(Bytes(32, 0x01));
+    chacha.setKey(Bytes(32, 0x01));
+    // Each pass sets the nonce again, as a sender would per message
+    const Bytes nonce(AEAD::NONCE_SIZE, 0x02);
+
+    const size_t sizes[] = { 64, 1024, 16 * 1024, 1024 * 1024, 16 * 1024 * 1024 };
+    Bytes in(sizes[std::size(sizes) - 1], 0x03);
+    Bytes out(AESCBC::ciphertextSize(in.size()) + AEAD::TAG_SIZE);
+
+    std::cout << "\nEncrypt throughput into a reused buffer, 256-bit keys (MB/s):\n"
+              << "  size        AES-CBC    AES-GCM    ChaCha20-Poly1305\n";
+    for (size_t size : sizes) {
+        auto pt = std::span<const uint8_t>(in).first(size);
+
+        double cbcRate = megabytesPerSecond(size, [&] { cbc.encrypt(pt, out); });
+        double gcmRate = megabytesPerSecond(size, [&] { gcm.setIV(nonce); gcm.encrypt(pt, out); });
+        double chachaRate = megabytesPerSecond(size, [&] { chacha.setIV(nonce); chacha.encrypt(pt, out); });
+
+        std::cout << "  " << size << " B: " << cbcRate << "  " << gcmRate << "  " << chachaRate << "\n";
+    }
+}
+
+TEST_CASE("Throughput Benchmark: OpenSSL RSA key handles", "[benchmark]") {
+    using namespace crypto::standard::openssl;
+    using clock = std::chrono::steady_clock;
+
+    crypto::standard::openssl::RSA rsa;
+    auto kp = rsa.generateKeyPair(2048);
+    RSAKey pub = RSAKey::fromPublicPem(kp.public_key);
+    RSAKey priv = RSAKey::fromPrivatePem(kp.private_key);
+
+    constexpr int kOps = 200;
+    Bytes msg(32, 0x05);
+    std::vector<Bytes> cts(kOps, pub.encrypt(msg));
+
+    auto opsPerSecond = [](int ops, auto&& fn) {
+        auto begin = clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = clock::now() - begin;
+        return static_cast<uint64_t>(ops / elapsed.count());
+    };
+
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "\nRSA-2048 OAEP-SHA256 decrypt (" << kOps << " ops):\n";
+    std::cout << "  PEM per call:   " << opsPerSecond(kOps, [&] { for (auto& ct : cts) rsa.decrypt(ct, kp.private_key); }) << " ops/sec\n";
+    std::cout << "  RSAKey handle:  " << opsPerSecond(kOps, [&] { for (auto& ct : cts) priv.decrypt(ct); }) << " ops/sec\n";
+    std::cout << "  decryptBatch (" << cores << " threads): " << opsPerSecond(kOps, [&] { priv.decryptBatch(cts); }) << " ops/sec\n";
+    std::cout << "RSA-2048 OAEP-SHA256 encrypt:\n";
+    std::cout << "  PEM per call:   " << opsPerSecond(kOps, [&] { for (int i = 0; i < kOps; ++i) rsa.encrypt(msg, kp.public_key); }) << " ops/sec\n";
+    std::cout << "  RSAKey handle:  " << opsPerSecond(kOps, [&] { for (int i = 0; i < kOps; ++i) pub.encrypt(msg); }) << " ops/sec\n";
+}
+
+TEST_CASE("Throughput Benchmark: Manual RSA vs OpenSSL", "[benchmark]") {
+    using clock = std::chrono::steady_clock;
+
+    auto seconds = [](auto&& fn) {
+        auto begin = clock::now();
+        fn();
+        return std::chrono::duration<double>(clock::now() - begin).count();
+    };
+
+    crypto::modern::asymmetric::RSA manual;
+    crypto::standard::openssl::RSA openssl;
+    Bytes msg(32, 0x05);
+
+    // Manual RSA is textbook (0x01 framing), the wrapper is OAEP-SHA256; the modexp dominates both
+    for (size_t bits : { size_t{2048}, size_t{3072} }) {
+        constexpr int kOps = 20;
+        crypto::core::asymmetric::KeyPair manualKey, opensslKey;
+        double manualGen = seconds([&] { manualKey = manual.generateKeyPair(bits); });
+        double opensslGen = seconds([&] { opensslKey = openssl.generateKeyPair(bits); });
+
+        Bytes manualCt = manual.encrypt(msg, manualKey.public_key);
+        Bytes opensslCt = openssl.encrypt(msg, opensslKey.public_key);
+
+        std::cout << "\nRSA-" << bits << " (" << kOps << " ops):\n";
+        std::cout << "  keygen:  manual " << manualGen << " s, OpenSSL " << opensslGen << " s\n";
+        std::cout << "  encrypt: manual " << kOps / seconds([&] { for (int i = 0; i < kOps; ++i) manual.encrypt(msg, manualKey.public_key); })
+                  << " ops/sec, OpenSSL " << kOps / seconds([&] { for (int i = 0; i < kOps; ++i) openssl.encrypt(msg, opensslKey.public_key); }) << " ops/sec\n";
+        std::cout << "  decrypt: manual " << kOps / seconds([&] { for (int i = 0; i < kOps; ++i) manual.decrypt(manualCt, manualKey.private_key); })
+                  << " ops/sec, OpenSSL " << kOps / seconds([&] { for (int i = 0; i < kOps; ++i) openssl.decrypt(opensslCt, opensslKey.private_key); }) << " ops/sec\n";
+    }
+}
+
+TEST_CASE("Throughput Benchmark: Manual RSA CRT decryption", "[benchmark]") {
+    using clock = std::chrono::steady_clock;
+
+    auto opsPerSecond = [](int ops, auto&& fn) {
+        auto begin = clock::now();
+        for (int i = 0; i < ops; ++i) fn();
+        return ops / std::chrono::duration<double>(clock::now() - begin).count();
+    };
+
+    crypto::modern::asymmetric::RSA rsa;
+    Bytes msg(32, 0x05);
+    for (size_t bits : { size_t{2048}, size_t{3072} }) {
+        constexpr int kOps = 20;
+        auto kp = rsa.generateKeyPair(bits);
+        Bytes ct = rsa.encrypt(msg, kp.public_key);
+
+        rsa.setCRT(false);
+        double plain = opsPerSecond(kOps, [&] { rsa.decrypt(ct, kp.private_key); });
+        rsa.setCRT(true);
+        double crt = opsPerSecond(kOps, [&] { rsa.decrypt(ct, kp.private_key); });
+
+        std::cout << "\nManual RSA-" << bits << " decrypt (blinded, " << kOps << " ops):\n";
+        std::cout << "  modPow(c, d, n): " << plain << " ops/sec\n";
+        std::cout << "  CRT + Garner:    " << crt << " ops/sec (" << crt / plain << "x)\n";
+    }
+}
+
+TEST_CASE("Throughput Benchmark: OpenSSL RSA keygen pool", "[benchmark]") {
+    using namespace crypto::standard::openssl;
+    using clock = std::chrono::steady_clock;
+
+    constexpr size_t kBits = 2048;
+    constexpr int kKeys = 8;
+    auto keysPerSecond = [](auto&& fn) {
+        auto begin = clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = clock::now() - begin;
+        return kKeys / elapsed.count();
+    };
+
+    RSAKeyPool pool;
+    std::cout << "\nRSA-" << kBits << " keygen (" << kKeys << " keys):\n";
+    std::cout << "  Sequential:            " << keysPerSecond([&] {
+        crypto::standard::openssl::RSA rsa;
+        for (int i = 0; i < kKeys; ++i) rsa.generateKeyPair(kBits);
+    }) << " keys/sec\n";
+    std::cout << "  Pool (" << pool.threads() << " threads):      " << keysPerSecond([&] {
+        for (auto& f : pool.generate(kBits, kKeys)) f.get();
+    }) << " keys/sec\n";
+}
+
+TEST_CASE("Protocol Benchmark: Body Encodings", "[benchmark][net]") {
+    using namespace net::protocol;
+
+    // Typical chat fan-out frame
+    Message push = Message::makePush({
+        {"event", "public_message"},
+        {"from_uid", 1234},
+        {"from_name", "benchmark_user"},
+        {"text", "The quick brown fox jumps over the lazy dog"}
+    });
+
+    const std::pair<const char*, BodyEncoding> formats[] = {
+        { "JSON",        BodyEncoding::Json },
+        { "MessagePack", BodyEncoding::MessagePack },
+        { "CBOR",        BodyEncoding::Cbor }
+    };
+
+    std::cout << "\nBytes on the wire (header + body):\n";
+    std::cout << "  JSON (pretty, legacy): " << kHeaderSize + push.j.dump(4).size() << "\n";
+    for (const auto& [name, encoding] : formats) {
+        std::cout << "  " << name << ": " << push.encode(encoding).size() << "\n";
+    }
+
+    for (const auto& [name, encoding] : formats) {
+        std::vector<uint8_t> frame = push.encode(encoding);
+        auto body = std::span<const uint8_t>(frame).subspan(kHeaderSize);
+
+        BENCHMARK(std::string("Encode ") + name) {
+            return push.encode(encoding);
+        };
+
+        BENCHMARK(std::string("Decode ") + name) {
+            return Message::decode(MessageType::Push, body, encoding);
+        };
+    }
+}
+
+TEST_CASE("Server Benchmark: Worker Pool Scaling", "[benchmark][net]") {
+    using namespace net::protocol;
+    using boost::asio::ip::tcp;
+
+    constexpr int kClients = 16;
+    constexpr int kRequestsPerClient = 2000;
+    constexpr int kPipelineDepth = 32;
+
+    auto router = std::make_shared<net::server::Router>();
+    auto sessions = std::make_shared<net::server::SessionManager>();
+    router->add("ping", [](const json&, uint32_t) -> json { return {{"msg", "pong"}}; });
+
+    std::vector<uint8_t> request = Message::makeRequest(1, "ping", json::object()).encode();
+
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int n = 1; n < cores; n *= 2) threadCounts.push_back(n);
+    threadCounts.push_back(cores);
+
+    const std::pair<const char*, net::server::ThreadingModel> models[] = {
+        { "shared io_context", net::server::ThreadingModel::SharedContext },
+        { "io_context per thread", net::server::ThreadingModel::ContextPerThread }
+    };
+
+    std::cout << "\nPing throughput (" << kClients << " clients, pipeline depth " << kPipelineDepth << "):\n";
+
+    for (const auto& [name, model] : models) {
+        for (unsigned int threads : threadCounts) {
+            net::server::ServerController controller(router, sessions);
+
+            net::server::ServerConfig cfg;
+            cfg.workerThreads = threads;
+            cfg.threading = model;
+            {
+                boost::asio::io_context probeIo;
+                tcp::acceptor probe(probeIo, {boost::asio::ip::address_v4::loopback(), 0});
+                cfg.port = probe.local_endpoint().port();
+            }
+            REQUIRE(controller.start(cfg));
+
+            auto begin = std::chrono::steady_clock::now();
+
+            // Each client keeps a window of requests in flight and drains the responses
+            std::vector<std::thread> clients;
+            for (int c = 0; c < kClients; ++c) {
+                clients.emplace_back([&] {
+                    boost::asio::io_context io;
+                    tcp::socket sock(io);
+                    sock.connect({boost::asio::ip::address_v4::loopback(), cfg.port});
+                    sock.set_option(tcp::no_delay(true));
+
+                    std::vector<uint8_t> body;
+                    for (int sent = 0; sent < kRequestsPerClient; sent += kPipelineDepth) {
+                        int batch = std::min(kPipelineDepth, kRequestsPerClient - sent);
+                        for (int i = 0; i < batch; ++i) boost::asio::write(sock, boost::asio::buffer(request));
+
+                        for (int i = 0; i < batch; ++i) {
+                            std::array<uint8_t, kHeaderSize> header{};
+                            boost::asio::read(sock, boost::asio::buffer(header));
+                            uint32_t len = (uint32_t(header[1]) << 24) | (uint32_t(header[2]) << 16) |
+                                           (uint32_t(header[3]) << 8)  |  uint32_t(header[4]);
+                            body.resize(len);
+                            boost::asio::read(sock, boost::asio::buffer(body));
+                        }
+                    }
+                });
+            }
+            for (auto& client : clients) client.join();
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+            controller.stopAll();
+
+            double total = double(kClients) * kRequestsPerClient;
+            std::cout << "  " << name << ", " << threads << " thread(s): "
+                      << static_cast<uint64_t>(total / elapsed.count()) << " msgs/sec\n";
+        }
+    }
+}
+
+TEST_CASE("Server Benchmark: SessionManager Contention", "[benchmark][net]") {
+    using namespace net::protocol;
+
+    // Accepts frames without doing anything, so only registry costs are measured
+    class NullSession : public net::core::ISession {
+    public:
+        void start() override {}
+        void onStart(const SessionCallback&) override {}
+        void close() override {}
+        void onClose(const SessionCallback&) override {}
+        void send(const Message&) override {}
+        void send(const SharedFrame&) override {}
+        void onMessage(const MessageCallback&) override {}
+        void onError(const ErrorCallback&) override {}
+        void setUid(uint32_t) override {}
+        uint32_t getUid() const override { return 0; }
+        BodyEncoding getEncoding() const override { return BodyEncoding::Json; }
+        net::core::SessionStats stats() const override { return {}; }
+    };
+
+    constexpr int kSessions = 1000;
+    constexpr int kOpsPerThread = 200000;
+
+    net::server::SessionManager sessions;
+    std::vector<uint32_t> uids;
+    for (int i = 0; i < kSessions; ++i) uids.push_back(sessions.add(std::make_shared<NullSession>()));
+
+    Message push = Message::makePush({{"event", "public_message"}, {"text", "hi"}});
+
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int n = 1; n < cores * 2; n *= 2) threadCounts.push_back(n);
+
+    std::cout << "\nSessionManager mixed load (" << kSessions << " sessions, "
+              << "1000 lookups : 10 sendTo : 1 add/remove : 1 broadcast):\n";
+
+    for (unsigned int threads : threadCounts) {
+        auto begin = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (unsigned int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (int i = 0; i < kOpsPerThread; ++i) {
+                    uint32_t uid = uids[(i * 7 + t) % uids.size()];
+                    int op = i % 1012;
+
+                    if (op < 1000)      sessions.getName(uid);
+                    else if (op < 1010) sessions.sendTo({uid}, push);
+                    else if (op < 1011) sessions.remove(sessions.add(std::make_shared<NullSession>()));
+                    else                sessions.broadcast(push);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+        double total = double(threads) * kOpsPerThread;
+        std::cout << "  " << threads << " thread(s): "
+                  << static_cast<uint64_t>(total / elapsed.count()) << " ops/sec\n";
+    }
+}
@@ -1,9 +1,18 @@
 #include <catch2/catch_all.hpp>
 #include <openssl/rand.h>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <type_traits>
+#include <algorithm>
+#include <limits>
 
 #include "crypto/standard/openssl/AESCBC.h"
+#include "crypto/standard/openssl/AESGCM.h"
+#include "crypto/standard/openssl/ChaCha20Poly1305.h"
 #include "crypto/standard/openssl/RSA.h"
+#include "crypto/standard/openssl/RSAKey.h"
+#include "crypto/standard/openssl/RSAKeyPool.h"
 #include "crypto/core/utils.h"
 
 using namespace crypto::core;
@@ -75,6 +84,199 @@ TEST_CASE("OpenSSL AES-CBC: Functional and Boundary Analysis", "[standard][aes][
     }
 }
 
+TEST_CASE("OpenSSL AES-CBC: Context reuse and streaming", "[standard][aes][cbc]") {
+    AESCBC aes(AESKeySize::AES_128);
+    aes.setKey(generate_random_bytes(16));
+    aes.setIV(generate_random_bytes(16));
+
+    Bytes pt = generate_random_bytes(100000);
+    Bytes ct = aes.encrypt(pt);
+
+    SECTION("Repeated calls on cached contexts are independent") {
+        REQUIRE(aes.encrypt(pt) == ct);
+        REQUIRE(aes.decrypt(ct) == pt);
+        REQUIRE(aes.encrypt(pt) == ct);
+
+        // A failed decrypt must not poison the next call
+        Bytes broken = ct;
+        broken.pop_back();
+        REQUIRE_THROWS_AS(aes.decrypt(broken), std::runtime_error);
+        REQUIRE(aes.decrypt(ct) == pt);
+    }
+
+    SECTION("IV and key changes take effect") {
+        aes.setIV(generate_random_bytes(16));
+        Bytes other = aes.encrypt(pt);
+        REQUIRE(other != ct);
+        REQUIRE(aes.decrypt(other) == pt);
+
+        aes.setKey(generate_random_bytes(16));
+        REQUIRE(aes.encrypt(pt) != other);
+    }
+
+    SECTION("Chunked update/finalize matches one-shot") {
+        for (size_t chunk : { 1u, 15u, 16u, 4096u, 65537u }) {
+            DYNAMIC_SECTION("chunk " << chunk) {
+                Bytes streamed;
+                aes.begin(AESCBC::Direction::Encrypt);
+                for (size_t off = 0; off < pt.size(); off += chunk) {
+                    Bytes part(pt.begin() + off, pt.begin() + std::min(pt.size(), off + chunk));
+                    Bytes out = aes.update(part);
+                    streamed.insert(streamed.end(), out.begin(), out.end());
+                }
+                Bytes tail = aes.finalize();
+                streamed.insert(streamed.end(), tail.begin(), tail.end());
+                REQUIRE(streamed == ct);
+
+                Bytes recovered;
+                aes.begin(AESCBC::Direction::Decrypt);
+                for (size_t off = 0; off < ct.size(); off += chunk) {
+                    Bytes part(ct.begin() + off, ct.begin() + std::min(ct.size(), off + chunk));
+                    Bytes out = aes.update(part);
+                    recovered.insert(recovered.end(), out.begin(), out.end());
+                    if (off == 0) REQUIRE(aes.decrypt(ct) == pt); // one-shot calls do not disturb the stream
+                }
+                tail = aes.finalize();
+                recovered.insert(recovered.end(), tail.begin(), tail.end());
+                REQUIRE(recovered == pt);
+            }
+        }
+    }
+
+    SECTION("Stream misuse") {
+        REQUIRE_THROWS_AS(aes.update(pt), std::runtime_error);
+        REQUIRE_THROWS_AS(aes.finalize(), std::runtime_error);
+
+        // Truncated ciphertext fails at finalize
+        aes.begin(AESCBC::Direction::Decrypt);
+        aes.update(Bytes(ct.begin(), ct.end() - 1));
+        REQUIRE_THROWS_AS(aes.finalize(), std::runtime_error);
+        REQUIRE_THROWS_AS(aes.update(pt), std::runtime_error);
+    }
+}
+
+// ============================================================
+// OPENSSL AEAD: AES-GCM / CHACHA20-POLY1305
+// ============================================================
+TEST_CASE("OpenSSL AEAD: Known answers", "[standard][aead]") {
+    SECTION("AES-128-GCM, GCM spec test case 4") {
+        AESGCM gcm(AESKeySize::AES_128);
+        gcm.setKey(utils::fromHex("feffe9928665731c6d6a8f9467308308"));
+        gcm.setIV(utils::fromHex("cafebabefacedbaddecaf888"));
+        gcm.setAAD(utils::fromHex("feedfacedeadbeeffeedfacedeadbeefabaddad2"));
+
+        Bytes pt = utils::fromHex(
+            "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+            "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39");
+        Bytes sealed = gcm.encrypt(pt);
+        REQUIRE(utils::toHex(sealed) ==
+            "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+            "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091"
+            "5bc94fbc3221a5db94fae95ae7121a47");
+        REQUIRE(gcm.decrypt(sealed) == pt);
+    }
+
+    SECTION("ChaCha20-Poly1305, RFC 8439 section 2.8.2") {
+        ChaCha20Poly1305 aead;
+        aead.setKey(utils::fromHex("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"));
+        aead.setIV(utils::fromHex("070000004041424344454647"));
+        aead.setAAD(utils::fromHex("50515253c0c1c2c3c4c5c6c7"));
+
+        std::string text = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip "
+                           "for the future, sunscreen would be it.";
+        Bytes pt(text.begin(), text.end());
+        Bytes sealed = aead.encrypt(pt);
+
+        REQUIRE(sealed.size() == pt.size() + AEAD::TAG_SIZE);
+        REQUIRE(utils::toHex(Bytes(sealed.begin(), sealed.begin() + 16)) == "d31a8d34648e60db7b86afbc53ef7ec2");
+        REQUIRE(utils::toHex(Bytes(sealed.end() - 16, sealed.end())) == "1ae10b594f09e26a7e902ecbd0600691");
+        REQUIRE(aead.decrypt(sealed) == pt);
+    }
+}
+
+TEST_CASE("OpenSSL AEAD: Reuse, tampering and streaming", "[standard][aead]") {
+    auto exercise = [](AEAD& aead) {
+        aead.setKey(generate_random_bytes(aead.keySize()));
+        Bytes nonce = generate_random_bytes(AEAD::NONCE_SIZE);
+        Bytes aad = generate_random_bytes(29);
+        Bytes pt = generate_random_bytes(70001);
+
+        aead.setIV(nonce);
+        aead.setAAD(aad);
+        Bytes sealed = aead.encrypt(pt);
+
+        // A nonce seals one message; decrypting with it again is fine
+        REQUIRE_THROWS_AS(aead.encrypt(pt), std::runtime_error);
+        REQUIRE_THROWS_AS(aead.begin(AEAD::Direction::Encrypt), std::runtime_error);
+
+        // Cached contexts give identical results on repeated calls and after a failure
+        REQUIRE(aead.decrypt(sealed) == pt);
+        Bytes tampered = sealed;
+        tampered[100] ^= 0x01;
+        REQUIRE_THROWS_AS(aead.decrypt(tampered), std::runtime_error);
+        REQUIRE(aead.decrypt(sealed) == pt);
+
+        aead.setAAD(Bytes{'x'});
+        REQUIRE_THROWS_AS(aead.decrypt(sealed), std::runtime_error);
+        aead.setAAD(aad);
+
+        // A new nonce must change the output
+        aead.setIV(generate_random_bytes(AEAD::NONCE_SIZE));
+        REQUIRE(aead.encrypt(pt) != sealed);
+
+        // The old nonce is set again below only to compare outputs against `sealed`
+        aead.setIV(nonce);
+        Bytes out(AEAD::ciphertextSize(pt.size()));
+        REQUIRE(aead.encrypt(pt, out) == out.size());
+        REQUIRE(out == sealed);
+
+        // Streaming in odd chunks, AAD split over two calls
+        aead.setIV(nonce);
+        Bytes streamed;
+        aead.begin(AEAD::Direction::Encrypt);
+        aead.addAAD(Bytes(aad.begin(), aad.begin() + 10));
+        aead.addAAD(Bytes(aad.begin() + 10, aad.end()));
+        for (size_t off = 0; off < pt.size(); off += 4099) {
+            Bytes part = aead.update(Bytes(pt.begin() + off, pt.begin() + std::min(pt.size(), off + 4099)));
+            streamed.insert(streamed.end(), part.begin(), part.end());
+        }
+        REQUIRE_THROWS_AS(aead.addAAD(aad), std::runtime_error);
+        Bytes tag = aead.finalize();
+        streamed.insert(streamed.end(), tag.begin(), tag.end());
+        REQUIRE(streamed == sealed);
+
+        Bytes ct(sealed.begin(), sealed.end() - AEAD::TAG_SIZE);
+        aead.begin(AEAD::Direction::Decrypt);
+        aead.addAAD(aad);
+        Bytes recovered = aead.update(ct);
+        REQUIRE(recovered == pt);
+        aead.finalize(tag);
+
+        tag[0] ^= 0x80;
+        aead.begin(AEAD::Direction::Decrypt);
+        aead.addAAD(aad);
+        aead.update(ct);
+        REQUIRE_THROWS_AS(aead.finalize(tag), std::runtime_error);
+    };
+
+    SECTION("AES-256-GCM") {
+        AESGCM gcm(AESKeySize::AES_256);
+        exercise(gcm);
+    }
+
+    SECTION("ChaCha20-Poly1305") {
+        ChaCha20Poly1305 aead;
+        exercise(aead);
+    }
+
+    SECTION("Input validation") {
+        ChaCha20Poly1305 aead;
+        REQUIRE_THROWS_AS(aead.setKey(Bytes(16)), std::invalid_argument);
+        REQUIRE_THROWS_AS(aead.setIV(Bytes(16)), std::invalid_argument);
+        REQUIRE_THROWS_AS(aead.encrypt(Bytes(4)), std::runtime_error);
+    }
+}
+
 // ============================================================
 // OPENSSL RSA: EXTENSIVE VALIDATION
 // ============================================================
@@ -146,6 +348,178 @@ TEST_CASE("OpenSSL RSA: Key Management and OAEP Integrity", "[standard][rsa]") {
     }
 }
 
+TEST_CASE("OpenSSL RSA: Parsed key handles and batches", "[standard][rsa]") {
+    crypto::standard::openssl::RSA rsa;
+    auto kp = rsa.generateKeyPair(2048);
+
+    RSAKey pub = RSAKey::fromPublicPem(kp.public_key);
+    RSAKey priv = RSAKey::fromPrivatePem(kp.private_key);
+
+    REQUIRE_FALSE(pub.isPrivate());
+    REQUIRE(priv.isPrivate());
+    REQUIRE(pub.bits() == 2048);
+    REQUIRE(pub.ciphertextSize() == 256);
+    REQUIRE(pub.maxPlaintextSize() == 190);
+
+    SECTION("Interoperates with the PEM API") {
+        Bytes msg = generate_random_bytes(32);
+        REQUIRE(rsa.decrypt(pub.encrypt(msg), kp.private_key) == msg);
+        REQUIRE(priv.decrypt(rsa.encrypt(msg, kp.public_key)) == msg);
+
+        // Repeated calls reuse the cached per-thread context
+        for (int i = 0; i < 5; ++i) REQUIRE(priv.decrypt(pub.encrypt(msg)) == msg);
+    }
+
+    SECTION("Batches keep order across threads") {
+        std::vector<Bytes> msgs;
+        for (int i = 0; i < 24; ++i) msgs.push_back(generate_random_bytes(1 + i));
+
+        auto cts = pub.encryptBatch(msgs, 3);
+        REQUIRE(cts.size() == msgs.size());
+        REQUIRE(priv.decryptBatch(cts, 4) == msgs);
+        REQUIRE(priv.decryptBatch(cts, 1) == msgs);
+        REQUIRE(priv.decryptBatch({}).empty());
+
+        cts[17][5] ^= 0x01;
+        REQUIRE_THROWS_AS(priv.decryptBatch(cts, 4), std::runtime_error);
+    }
+
+    SECTION("Shared handle used from several threads") {
+        Bytes msg = generate_random_bytes(64);
+        Bytes ct = pub.encrypt(msg);
+        std::atomic<int> ok{0};
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([copy = priv, &ct, &msg, &ok] {
+                for (int i = 0; i < 5; ++i) {
+                    if (copy.decrypt(ct) == msg) ok.fetch_add(1);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        REQUIRE(ok.load() == 20);
+    }
+
+    SECTION("Cached contexts follow their threads and keys") {
+        Bytes msg = generate_random_bytes(16);
+        Bytes ct = pub.encrypt(msg);
+        REQUIRE(pub.cachedContexts() == 1);
+
+        // PEM calls use a throwaway context
+        REQUIRE(rsa.decrypt(ct, kp.private_key) == msg);
+        REQUIRE(priv.cachedContexts() == 0);
+
+        REQUIRE(priv.decrypt(ct) == msg);
+        REQUIRE(priv.cachedContexts() == 1);
+
+        bool decrypted = false;
+        size_t whileRunning = 0;
+        std::thread([&] {
+            decrypted = priv.decrypt(ct) == msg;
+            whileRunning = priv.cachedContexts();
+        }).join();
+        REQUIRE(decrypted);
+        REQUIRE(whileRunning == 2);
+        REQUIRE(priv.cachedContexts() == 1);
+
+        // A key dropped while its context is still cached here is simply skipped and recycled
+        {
+            RSAKey temp = RSAKey::fromPrivatePem(kp.private_key);
+            REQUIRE(temp.decrypt(ct) == msg);
+        }
+        REQUIRE(priv.decrypt(ct) == msg);
+        REQUIRE(priv.cachedContexts() == 1);
+    }
+
+    SECTION("Misuse") {
+        REQUIRE_THROWS_AS(pub.decrypt(Bytes(256, 0)), std::runtime_error);
+        REQUIRE_THROWS_AS(pub.encrypt(Bytes(191, 0)), std::runtime_error);
+        REQUIRE_THROWS_AS(RSAKey::fromPrivatePem(kp.public_key), std::runtime_error);
+
+        // A 512-bit modulus is too small for any OAEP-SHA-256 plaintext
+        RSAKey tiny = RSAKey::fromPublicPem(rsa.generateKeyPair(512).public_key);
+        REQUIRE(tiny.maxPlaintextSize() == 0);
+        REQUIRE_THROWS_AS(tiny.encrypt(Bytes(1, 0)), std::runtime_error);
+    }
+}
+
+TEST_CASE("OpenSSL RSA: Parallel keygen pool", "[standard][rsa]") {
+    RSAKeyPool pool(2);
+    REQUIRE(pool.threads() == 2);
+
+    SECTION("Batch of independent, usable keys") {
+        auto futures = pool.generate(1024, 4);
+        REQUIRE(futures.size() == 4);
+
+        std::vector<KeyPair> keys;
+        for (auto& f : futures) keys.push_back(f.get());
+
+        for (size_t i = 0; i < keys.size(); ++i) {
+            RSAKey pub = RSAKey::fromPublicPem(keys[i].public_key);
+            RSAKey priv = RSAKey::fromPrivatePem(keys[i].private_key);
+            REQUIRE(pub.bits() == 1024);
+
+            Bytes msg = generate_random_bytes(16);
+            REQUIRE(priv.decrypt(pub.encrypt(msg)) == msg);
+            for (size_t j = i + 1; j < keys.size(); ++j) REQUIRE(keys[i].public_key != keys[j].public_key);
+        }
+    }
+
+    SECTION("Background stock serves acquire without waiting") {
+        pool.reserve(1024, 2);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (pool.stocked(1024) < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        REQUIRE(pool.stocked(1024) == 2);
+
+        auto ready = pool.acquire(1024);
+        REQUIRE(ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        REQUIRE(RSAKey::fromPrivatePem(ready.get().private_key).bits() == 1024);
+
+        // An empty stock falls back to a queued request
+        REQUIRE(pool.acquire(2048).get().private_key.size() > 0);
+        pool.reserve(1024, 0);
+    }
+
+    SECTION("A failing stock stops refilling and keeps its error") {
+        // Passes reserve() but is rejected by every generateKeyPair() attempt
+        const size_t tooLarge = static_cast<size_t>(std::numeric_limits<int>::max()) + 1;
+        pool.reserve(tooLarge, 1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (!pool.stockError(tooLarge) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        REQUIRE(pool.stockError(tooLarge));
+        REQUIRE_THROWS_AS(std::rethrow_exception(pool.stockError(tooLarge)), std::invalid_argument);
+        REQUIRE(pool.stocked(tooLarge) == 0);
+        REQUIRE(pool.stockError(1024) == nullptr);
+
+        // Other sizes are unaffected
+        REQUIRE(pool.acquire(1024).get().private_key.size() > 0);
+    }
+
+    SECTION("Errors reach the future") {
+        REQUIRE_THROWS_AS(pool.reserve(512, 1), std::invalid_argument);
+        auto bad = pool.generate(64);
+        REQUIRE_THROWS_AS(bad.get(), std::runtime_error);
+    }
+
+    SECTION("Destruction fails queued requests") {
+        std::vector<std::future<KeyPair>> futures;
+        {
+            RSAKeyPool small(1);
+            futures = small.generate(2048, 6);
+        }
+        size_t failed = 0;
+        for (auto& f : futures) {
+            try { f.get(); } catch (const std::runtime_error&) { ++failed; }
+        }
+        REQUIRE(failed >= 4);
+    }
+}
+
 // ============================================================
 // MEMORY SAFETY: ZEROIZATION CHECK
 // ============================================================
@@ -190,6 +564,59 @@ TEST_CASE("Standard DES: OpenSSL Wrapper Functional Test", "[standard][des]") {
     SECTION("Validation") {
         REQUIRE_THROWS_AS(des.setKey(Bytes(7)), std::invalid_argument);
     }
+
+    SECTION("FIPS 46 vector (CBC with a zero IV equals ECB for the first block)") {
+        Bytes ct = des.encrypt(utils::fromHex("4E6F772069732074"));
+        REQUIRE(ct.size() == 16);
+        REQUIRE(utils::toHex(Bytes(ct.begin(), ct.begin() + 8)) == "3fa40e8a984d4815");
+    }
+}
+
+TEST_CASE("Standard wrappers: Caller buffers and in-place encryption", "[standard][aes][des]") {
+    auto exercise = [](auto& cipher, size_t blockSize) {
+        using Cipher = std::decay_t<decltype(cipher)>;
+
+        for (size_t size : { size_t{0}, size_t{1}, blockSize - 1, blockSize, size_t{1000} }) {
+            INFO("plaintext " << size << " bytes");
+            Bytes pt = generate_random_bytes(size);
+            Bytes expected = cipher.encrypt(pt);
+            REQUIRE(Cipher::ciphertextSize(size) == expected.size());
+
+            // Recycled buffer larger than needed
+            Bytes out(4096, 0xEE);
+            size_t written = cipher.encrypt(pt, out);
+            REQUIRE(written == expected.size());
+            REQUIRE(std::equal(expected.begin(), expected.end(), out.begin()));
+
+            Bytes back(4096);
+            REQUIRE(cipher.decrypt(std::span<const uint8_t>(out).first(written), back) == size);
+            REQUIRE(std::equal(pt.begin(), pt.end(), back.begin()));
+
+            Bytes buffer(Cipher::ciphertextSize(size));
+            std::copy(pt.begin(), pt.end(), buffer.begin());
+            REQUIRE(cipher.encryptInPlace(buffer, size) == buffer.size());
+            REQUIRE(buffer == expected);
+            REQUIRE(cipher.decryptInPlace(buffer) == size);
+            REQUIRE(std::equal(pt.begin(), pt.end(), buffer.begin()));
+
+            Bytes tooSmall(Cipher::ciphertextSize(size) - 1);
+            REQUIRE_THROWS_AS(cipher.encrypt(pt, tooSmall), std::invalid_argument);
+        }
+    };
+
+    SECTION("AES-CBC") {
+        AESCBC aes(AESKeySize::AES_256);
+        aes.setKey(generate_random_bytes(32));
+        aes.setIV(generate_random_bytes(16));
+        exercise(aes, 16);
+    }
+
+    SECTION("DES-CBC") {
+        DES des;
+        des.setKey(generate_random_bytes(8));
+        des.setIV(generate_random_bytes(8));
+        exercise(des, 8);
+    }
 }
 
 TEST_CASE("Standard AES: OpenSSL Wrapper Functional Test", "[standard][aes]") {